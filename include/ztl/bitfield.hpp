@@ -0,0 +1,131 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Register and bitfield descriptors
+///
+/// \file   ztl/bitfield.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include "bits.hpp"
+
+namespace ztl {
+
+/// Bitfield of a register
+///
+/// An instance of a field holds a value already mapped to the fields mask.
+///
+/// \tparam Reg   Type of register
+/// \tparam Mask  Bitmask of field within register
+template<typename Reg, auto Mask>
+requires(std::unsigned_integral<decltype(Mask)> && Mask != 0u &&
+         std::cmp_less_equal(Mask,
+                             std::numeric_limits<
+                               typename Reg::value_type>::max()))
+struct field {
+  using register_type = Reg;
+  using value_type = Reg::value_type;
+
+  static constexpr auto mask{static_cast<value_type>(Mask)};
+
+  /// Ctor
+  ///
+  /// \tparam T     Type of value
+  /// \param  value Field value
+  template<std::unsigned_integral T>
+  explicit constexpr field(T value) : _bits{map_value_to<mask>(value)} {}
+
+  /// Extract field value from register value
+  ///
+  /// \param  value Register value
+  /// \return Field value
+  static constexpr value_type get(value_type value) {
+    return map_value_from<mask>(value);
+  }
+
+  /// Field value mapped to register
+  constexpr value_type bits() const { return _bits; }
+
+private:
+  value_type _bits{};
+};
+
+/// Register
+///
+/// Field writes passed to write or modify are merged into a single store.
+///
+/// \tparam T   Type of register
+/// \tparam Tag Tag to distinguish registers of the same type
+template<std::unsigned_integral T, typename Tag = void>
+struct reg {
+  using value_type = T;
+
+  /// Ctor
+  ///
+  /// \param  r Underlying memory (e.g. memory-mapped peripheral register)
+  explicit constexpr reg(value_type volatile& r) : _r{&r} {}
+
+  /// Read register
+  ///
+  /// \return Register value
+  value_type read() const { return *_r; }
+
+  /// Read field
+  ///
+  /// \tparam F Field
+  /// \return Field value
+  template<typename F>
+  requires std::same_as<typename F::register_type, reg>
+  value_type read() const {
+    return F::get(*_r);
+  }
+
+  /// Write register
+  ///
+  /// \param  value Register value
+  void write(value_type value) { *_r = value; }
+
+  /// Write fields, all other bits are cleared
+  ///
+  /// \tparam Fs... Fields
+  /// \param  fs    Fields
+  template<typename... Fs>
+  requires(sizeof...(Fs) > 0uz &&
+           (std::same_as<typename Fs::register_type, reg> && ...))
+  void write(Fs... fs) {
+    static_assert(disjoint<Fs...>(), "Fields must not overlap");
+    *_r = static_cast<value_type>((fs.bits() | ...));
+  }
+
+  /// Read-modify-write fields, all other bits are retained
+  ///
+  /// \tparam Fs... Fields
+  /// \param  fs    Fields
+  template<typename... Fs>
+  requires(sizeof...(Fs) > 0uz &&
+           (std::same_as<typename Fs::register_type, reg> && ...))
+  void modify(Fs... fs) {
+    static_assert(disjoint<Fs...>(), "Fields must not overlap");
+    constexpr auto clear{static_cast<value_type>(~(Fs::mask | ...))};
+    *_r = static_cast<value_type>((*_r & clear) | (fs.bits() | ...));
+  }
+
+private:
+  template<typename... Fs>
+  static consteval bool disjoint() {
+    return std::popcount(static_cast<value_type>((Fs::mask | ...))) ==
+           (std::popcount(Fs::mask) + ...);
+  }
+
+  value_type volatile* _r;
+};
+
+} // namespace ztl
@@ -13,11 +13,18 @@
 #include <array>
 #include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <limits>
 #include <type_traits>
 #include <utility>
 #include "limits.hpp"
 
+#if defined(__BMI2__)
+#  include <immintrin.h>
+#endif
+
 namespace ztl {
 
 /// Make mask from bit positions
@@ -133,7 +140,8 @@ constexpr auto map_value_to(T value) {
     constexpr auto runs{detail::mask_runs<Mask>()};
     R retval{};
     for (auto [start, length] : runs) {
-      retval |= (value & ((static_cast<R>(1u) << length) - 1u)) << start;
+      retval |= static_cast<R>((value & ((static_cast<R>(1u) << length) - 1u))
+                               << start);
       value >>= length;
     }
     return retval;
@@ -163,13 +171,400 @@ constexpr auto map_value_from(T value) {
     R retval{};
     size_t shift{};
     for (auto [start, length] : runs) {
-      retval |=
+      retval |= static_cast<R>(
         (static_cast<R>(value >> start) & ((static_cast<R>(1u) << length) - 1u))
-        << shift;
+        << shift);
       shift += length;
     }
     return retval;
   }
 }
 
+/// Map value to runtime bitmask
+///
+/// Same as map_value_to<Mask> but with a bitmask only known at runtime. Uses
+/// PDEP on targets with BMI2.
+///
+/// \tparam T     Type of bitmask and return type
+/// \tparam U     Type of value
+/// \param  mask  Bitmask
+/// \param  value Value
+/// \return Mapped value
+template<std::unsigned_integral T, std::unsigned_integral U>
+constexpr T map_value_to(T mask, U value) {
+#if defined(__BMI2__)
+  if !consteval {
+    if constexpr (sizeof(T) <= sizeof(uint32_t))
+      return static_cast<T>(_pdep_u32(static_cast<uint32_t>(value), mask));
+    else return static_cast<T>(_pdep_u64(static_cast<uint64_t>(value), mask));
+  }
+#endif
+  T retval{};
+  while (mask) {
+    auto const start{std::countr_zero(mask)};
+    auto const run{static_cast<T>(mask & ~(mask + (mask & -mask)))};
+    retval |=
+      static_cast<T>(static_cast<T>(static_cast<T>(value) << start) & run);
+    value = static_cast<U>((value >> (std::popcount(run) - 1)) >> 1u);
+    mask &= static_cast<T>(~run);
+  }
+  return retval;
+}
+
+/// Map value from runtime bitmask - reverts the map_value_to operation
+///
+/// Same as map_value_from<Mask> but with a bitmask only known at runtime. Uses
+/// PEXT on targets with BMI2.
+///
+/// \tparam T     Type of bitmask and return type
+/// \tparam U     Type of value
+/// \param  mask  Bitmask
+/// \param  value Value
+/// \return Remapped value
+template<std::unsigned_integral T, std::unsigned_integral U>
+constexpr T map_value_from(T mask, U value) {
+#if defined(__BMI2__)
+  if !consteval {
+    if constexpr (sizeof(T) <= sizeof(uint32_t))
+      return static_cast<T>(_pext_u32(static_cast<uint32_t>(value), mask));
+    else return static_cast<T>(_pext_u64(static_cast<uint64_t>(value), mask));
+  }
+#endif
+  T retval{};
+  auto shift{0};
+  while (mask) {
+    auto const start{std::countr_zero(mask)};
+    auto const run{static_cast<T>(mask & ~(mask + (mask & -mask)))};
+    retval |= static_cast<T>((static_cast<T>(value) & run) >> start << shift);
+    shift += std::popcount(run);
+    mask &= static_cast<T>(~run);
+  }
+  return retval;
+}
+
+/// Map values to and from a runtime bitmask
+///
+/// Splits the bitmask into runs once on construction. Each run is stored as
+/// its bits together with the distance between the run and the corresponding
+/// bits of the value, so mapping takes a single shift and mask per run.
+///
+/// \tparam T Type of bitmask
+template<std::unsigned_integral T>
+struct bit_mapper {
+  using value_type = T;
+
+  /// Default ctor
+  constexpr bit_mapper() = default;
+
+  /// Ctor
+  ///
+  /// \param  mask  Bitmask
+  explicit constexpr bit_mapper(value_type mask) : _mask{mask} {
+    auto shift{0};
+    while (mask) {
+      auto const start{std::countr_zero(mask)};
+      auto const run{static_cast<T>(mask & ~(mask + (mask & -mask)))};
+      _runs[_size++] = {run, static_cast<uint8_t>(start - shift)};
+      shift += std::popcount(run);
+      mask &= static_cast<T>(~run);
+    }
+  }
+
+  /// Map value to bitmask
+  ///
+  /// \tparam U     Type of value
+  /// \param  value Value
+  /// \return Mapped value
+  template<std::unsigned_integral U>
+  constexpr value_type to(U value) const {
+    value_type retval{};
+    for (auto i{0uz}; i < _size; ++i)
+      retval |= static_cast<T>(
+        static_cast<T>(static_cast<T>(value) << _runs[i].shift) & _runs[i].run);
+    return retval;
+  }
+
+  /// Map value from bitmask
+  ///
+  /// \tparam U     Type of value
+  /// \param  value Value
+  /// \return Remapped value
+  template<std::unsigned_integral U>
+  constexpr value_type from(U value) const {
+    value_type retval{};
+    for (auto i{0uz}; i < _size; ++i)
+      retval |= static_cast<T>((static_cast<T>(value) & _runs[i].run) >>
+                               _runs[i].shift);
+    return retval;
+  }
+
+  constexpr value_type mask() const { return _mask; }
+
+  constexpr size_t runs_count() const { return _size; }
+
+private:
+  struct run_type {
+    value_type run{};
+    uint8_t shift{};
+  };
+
+  std::array<run_type, (std::numeric_limits<T>::digits + 1uz) / 2uz> _runs{};
+  uint8_t _size{};
+  value_type _mask{};
+};
+
+/// Reverse bits
+///
+/// Swaps adjacent bits, pairs and nibbles with SWAR masks and reverses the
+/// bytes with std::byteswap.
+///
+/// \tparam T     Type of value
+/// \param  value Value
+/// \return Value with reversed bit order
+template<std::unsigned_integral T>
+constexpr T reverse_bits(T value) {
+  constexpr auto m1{static_cast<T>(0x5555'5555'5555'5555ull)};
+  constexpr auto m2{static_cast<T>(0x3333'3333'3333'3333ull)};
+  constexpr auto m4{static_cast<T>(0x0F0F'0F0F'0F0F'0F0Full)};
+  value = static_cast<T>((value >> 1 & m1) | (value & m1) << 1);
+  value = static_cast<T>((value >> 2 & m2) | (value & m2) << 2);
+  value = static_cast<T>((value >> 4 & m4) | (value & m4) << 4);
+  if constexpr (sizeof(T) > 1uz) value = std::byteswap(value);
+  return value;
+}
+
+/// Convert value from native byte order to byte order E
+///
+/// \tparam E     Target byte order
+/// \tparam T     Type of value
+/// \param  value Value in native byte order
+/// \return Value in byte order E
+template<std::endian E, std::integral T>
+requires(E == std::endian::little || E == std::endian::big)
+constexpr T to_endian(T value) {
+  if constexpr (E == std::endian::native) return value;
+  else return std::byteswap(value);
+}
+
+/// Convert value from byte order E to native byte order
+///
+/// \tparam E     Source byte order
+/// \tparam T     Type of value
+/// \param  value Value in byte order E
+/// \return Value in native byte order
+template<std::endian E, std::integral T>
+requires(E == std::endian::little || E == std::endian::big)
+constexpr T from_endian(T value) {
+  return to_endian<E>(value);
+}
+
+namespace detail {
+
+/// Unsigned type twice as wide as T
+template<std::unsigned_integral T>
+requires(std::numeric_limits<T>::digits <= 32)
+using double_width_t =
+  smallest_unsigned_t<(std::numeric_limits<T>::digits >= 32
+                         ? ~0ull
+                         : (1ull << (2 * std::numeric_limits<T>::digits)) -
+                             1ull)>;
+
+/// Unsigned type half as wide as T
+template<std::unsigned_integral T>
+using half_width_t =
+  smallest_unsigned_t<(1ull << (std::numeric_limits<T>::digits / 2)) - 1ull>;
+
+/// Spread lower half of value to even bits
+///
+/// \tparam T     Type of value
+/// \param  value Value
+/// \return Spread value
+template<std::unsigned_integral T>
+constexpr T spread_bits(T value) {
+  constexpr auto digits{std::numeric_limits<T>::digits};
+  if constexpr (digits > 32)
+    value = static_cast<T>((value | value << 16) &
+                           static_cast<T>(0x0000'FFFF'0000'FFFFull));
+  if constexpr (digits > 16)
+    value = static_cast<T>((value | value << 8) &
+                           static_cast<T>(0x00FF'00FF'00FF'00FFull));
+  if constexpr (digits > 8)
+    value = static_cast<T>((value | value << 4) &
+                           static_cast<T>(0x0F0F'0F0F'0F0F'0F0Full));
+  value = static_cast<T>((value | value << 2) &
+                         static_cast<T>(0x3333'3333'3333'3333ull));
+  value = static_cast<T>((value | value << 1) &
+                         static_cast<T>(0x5555'5555'5555'5555ull));
+  return value;
+}
+
+/// Compact even bits of value to lower half
+///
+/// \tparam T     Type of value
+/// \param  value Value
+/// \return Compacted value
+template<std::unsigned_integral T>
+constexpr T compact_bits(T value) {
+  constexpr auto digits{std::numeric_limits<T>::digits};
+  value &= static_cast<T>(0x5555'5555'5555'5555ull);
+  value = static_cast<T>((value | value >> 1) &
+                         static_cast<T>(0x3333'3333'3333'3333ull));
+  value = static_cast<T>((value | value >> 2) &
+                         static_cast<T>(0x0F0F'0F0F'0F0F'0F0Full));
+  if constexpr (digits > 8)
+    value = static_cast<T>((value | value >> 4) &
+                           static_cast<T>(0x00FF'00FF'00FF'00FFull));
+  if constexpr (digits > 16)
+    value = static_cast<T>((value | value >> 8) &
+                           static_cast<T>(0x0000'FFFF'0000'FFFFull));
+  if constexpr (digits > 32)
+    value = static_cast<T>((value | value >> 16) &
+                           static_cast<T>(0x0000'0000'FFFF'FFFFull));
+  return value;
+}
+
+/// Lookup table of bytes with reversed bit order
+inline constexpr auto reverse_bits_table{[] {
+  std::array<uint8_t, 256uz> retval{};
+  for (auto i{0uz}; i < size(retval); ++i)
+    retval[i] = reverse_bits(static_cast<uint8_t>(i));
+  return retval;
+}()};
+
+/// Lookup table of bytes spread to even bits
+inline constexpr auto spread_bits_table{[] {
+  std::array<uint16_t, 256uz> retval{};
+  for (auto i{0uz}; i < size(retval); ++i)
+    retval[i] = spread_bits(static_cast<uint16_t>(i));
+  return retval;
+}()};
+
+} // namespace detail
+
+/// Reverse bits using a lookup table
+///
+/// Table based alternative to reverse_bits which trades 256 bytes of flash for
+/// fewer instructions on cores without barrel shifter.
+///
+/// \tparam T     Type of value
+/// \param  value Value
+/// \return Value with reversed bit order
+template<std::unsigned_integral T>
+constexpr T reverse_bits_lut(T value) {
+  T retval{};
+  for (auto i{0uz}; i < sizeof(T); ++i) {
+    if constexpr (sizeof(T) > 1uz) retval = static_cast<T>(retval << 8);
+    retval |= detail::reverse_bits_table[value & 0xFFu];
+    if constexpr (sizeof(T) > 1uz) value = static_cast<T>(value >> 8);
+  }
+  return retval;
+}
+
+/// Interleave bits of two values (Morton code)
+///
+/// Bits of x end up on even, bits of y on odd positions of the result.
+///
+/// \tparam T Type of values
+/// \param  x First value
+/// \param  y Second value
+/// \return Interleaved value
+template<std::unsigned_integral T>
+requires(std::numeric_limits<T>::digits <= 32)
+constexpr detail::double_width_t<T> interleave_bits(T x, T y) {
+  using R = detail::double_width_t<T>;
+  return static_cast<R>(detail::spread_bits(static_cast<R>(x)) |
+                        detail::spread_bits(static_cast<R>(y)) << 1);
+}
+
+/// Interleave bits of two values (Morton code) using a lookup table
+///
+/// \tparam T Type of values
+/// \param  x First value
+/// \param  y Second value
+/// \return Interleaved value
+template<std::unsigned_integral T>
+requires(std::numeric_limits<T>::digits <= 32)
+constexpr detail::double_width_t<T> interleave_bits_lut(T x, T y) {
+  using R = detail::double_width_t<T>;
+  R retval{};
+  for (auto i{0uz}; i < sizeof(T); ++i)
+    retval |= static_cast<R>(
+      static_cast<R>(detail::spread_bits_table[(x >> (8uz * i)) & 0xFFu] |
+                     detail::spread_bits_table[(y >> (8uz * i)) & 0xFFu] << 1)
+      << (16uz * i));
+  return retval;
+}
+
+/// Deinterleave bits of a value (Morton code)
+///
+/// \tparam T     Type of value
+/// \param  value Interleaved value
+/// \return Pair of values from even and odd bits
+template<std::unsigned_integral T>
+requires(std::numeric_limits<T>::digits % 2 == 0)
+constexpr std::pair<detail::half_width_t<T>, detail::half_width_t<T>>
+deinterleave_bits(T value) {
+  using R = detail::half_width_t<T>;
+  return {static_cast<R>(detail::compact_bits(value)),
+          static_cast<R>(detail::compact_bits(static_cast<T>(value >> 1)))};
+}
+
+/// Range over indices of set bits
+///
+/// Each increment clears the lowest set bit and each dereference counts
+/// trailing zeros, so iterating costs one step per set bit.
+///
+/// \tparam T Type of mask
+template<std::unsigned_integral T>
+struct set_bits_view {
+  struct iterator {
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr iterator() = default;
+    explicit constexpr iterator(T mask) : _mask{mask} {}
+
+    constexpr value_type operator*() const {
+      return static_cast<size_t>(std::countr_zero(_mask));
+    }
+
+    constexpr iterator& operator++() {
+      _mask &= static_cast<T>(_mask - 1u);
+      return *this;
+    }
+
+    constexpr iterator operator++(int) {
+      iterator retval{*this};
+      ++*this;
+      return retval;
+    }
+
+    constexpr bool operator==(iterator const&) const = default;
+
+  private:
+    T _mask{};
+  };
+
+  constexpr set_bits_view() = default;
+  explicit constexpr set_bits_view(T mask) : _mask{mask} {}
+
+  constexpr iterator begin() const { return iterator{_mask}; }
+  constexpr iterator end() const { return iterator{}; }
+
+private:
+  T _mask{};
+};
+
+/// Iterate over indices of set bits
+///
+/// \tparam T     Type of mask
+/// \param  mask  Mask
+/// \return Range over indices of set bits in ascending order
+template<std::unsigned_integral T>
+constexpr set_bits_view<T> set_bits(T mask) {
+  return set_bits_view<T>{mask};
+}
+
 } // namespace ztl
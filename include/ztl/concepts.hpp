@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <concepts>
 #include "meta.hpp"
 #include "utility.hpp"
@@ -19,4 +20,7 @@ namespace ztl {
 template<typename T>
 concept chrono_duration = is_chrono_duration_v<T>;
 
+template<typename T>
+concept chrono_clock = std::chrono::is_clock_v<T>;
+
 } // namespace ztl
@@ -10,10 +10,13 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <utility>
+#include "inplace_bitset.hpp"
 #include "limits.hpp"
 
 namespace ztl {
@@ -39,13 +42,16 @@ struct counted_latch {
   /// Set latch
   ///
   /// \param  value Next value
-  void set(value_type const& value) {
+  /// \return true if latched value changed
+  bool set(value_type const& value) {
     if (_next_value != value) {
       reset();
       _next_value = value;
     }
-    if (++_count < I) return;
+    if (_count >= I || ++_count < I) return false;
+    auto const retval{_value != _next_value};
     _value = _next_value;
+    return retval;
   }
 
   /// Reset latch
@@ -71,4 +77,71 @@ private:
   smallest_unsigned_t<I> _count{};
 };
 
+/// Bank of N boolean counted latches
+///
+/// Behaves like N counted_latch<bool, I> but stores inputs as bits and the
+/// counters as bit-planes (vertical counters). Each call to set() debounces all
+/// inputs with a handful of bitwise operations per word and per counter bit.
+///
+/// \tparam N Number of latches
+/// \tparam I Times to latch
+template<size_t N, size_t I>
+requires(N > 0uz && I > 0uz)
+struct counted_latch_bank {
+  using value_type = inplace_bitset<N>;
+
+  /// Default ctor
+  constexpr counted_latch_bank() = default;
+
+  /// Ctor
+  ///
+  /// \param  value Initial values
+  constexpr counted_latch_bank(value_type const& value) : _value{value} {}
+
+  /// Set latches
+  ///
+  /// \param  value Next values
+  /// \return Mask of latches whose value changed
+  constexpr value_type set(value_type const& value) {
+    // Count inputs which differ from their latched value, clear the others
+    auto const diff{value ^ _value};
+    auto carry{diff};
+    for (auto& plane : _planes) {
+      auto const c{plane};
+      plane ^= carry;
+      carry &= c;
+    }
+
+    // Latch inputs whose counter reached I
+    auto retval{diff};
+    for (auto b{0uz}; b < size(_planes); ++b)
+      retval &= I & (1uz << b) ? _planes[b] : ~_planes[b];
+    _value ^= retval;
+    auto const keep{diff ^ retval};
+    for (auto& plane : _planes) plane &= keep;
+    return retval;
+  }
+
+  /// Reset latches
+  void reset() { _planes = {}; }
+
+  /// Reset latches
+  ///
+  /// \param  value Reset values
+  void reset(value_type const& value) {
+    reset();
+    _value = value;
+  }
+
+  constexpr value_type const& value() const& { return _value; }
+  constexpr value_type const&& value() const&& { return std::move(_value); }
+
+  constexpr operator value_type const&() const& { return value(); }
+  constexpr operator value_type const&&() const&& { return std::move(value()); }
+
+private:
+  value_type _value{};
+  std::array<value_type, std::bit_width(I)> _planes{};
+};
+
 } // namespace ztl
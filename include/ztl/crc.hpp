@@ -0,0 +1,214 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// CRC and checksums
+///
+/// \file   ztl/crc.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include "bits.hpp"
+
+namespace ztl {
+
+namespace detail {
+
+/// Feed a single byte through CRC table
+///
+/// \tparam RefIn  Reflected CRC
+/// \tparam T      Type of CRC
+/// \param  table  Table
+/// \param  c      Current CRC register
+/// \param  byte   Byte
+/// \return Next CRC register
+template<bool RefIn, std::unsigned_integral T>
+constexpr T crc_next(std::array<T, 256uz> const& table, T c, uint8_t byte) {
+  constexpr auto width{std::numeric_limits<T>::digits};
+  if constexpr (width == 8) return table[c ^ byte];
+  else if constexpr (RefIn)
+    return static_cast<T>((c >> 8) ^ table[(c ^ byte) & 0xFFu]);
+  else
+    return static_cast<T>((c << 8) ^
+                          table[((c >> (width - 8)) ^ byte) & 0xFFu]);
+}
+
+/// Create CRC lookup tables
+///
+/// \tparam Poly   Polynomial
+/// \tparam RefIn  Reflected CRC
+/// \tparam Slices Number of tables
+/// \return Lookup tables
+template<auto Poly, bool RefIn, size_t Slices>
+consteval auto make_crc_tables() {
+  using T = decltype(Poly);
+  constexpr auto width{std::numeric_limits<T>::digits};
+  std::array<std::array<T, 256uz>, Slices> retval{};
+  for (auto i{0uz}; i < 256uz; ++i) {
+    if constexpr (RefIn) {
+      auto c{static_cast<T>(i)};
+      for (auto j{0uz}; j < 8uz; ++j)
+        c = static_cast<T>(c & 1u ? (c >> 1) ^ reverse_bits(Poly) : c >> 1);
+      retval[0uz][i] = c;
+    } else {
+      auto c{static_cast<T>(i << (width - 8))};
+      for (auto j{0uz}; j < 8uz; ++j)
+        c = static_cast<T>(c >> (width - 1) ? (c << 1) ^ Poly : c << 1);
+      retval[0uz][i] = c;
+    }
+  }
+  for (auto k{1uz}; k < Slices; ++k)
+    for (auto i{0uz}; i < 256uz; ++i)
+      retval[k][i] = crc_next<RefIn>(retval[0uz], retval[k - 1uz][i], 0u);
+  return retval;
+}
+
+} // namespace detail
+
+/// Table driven CRC
+///
+/// Parameters follow the Rocksoft model (Poly and Init are given in normal,
+/// i.e. non-reflected, form). The width of the CRC is the width of the type of
+/// Poly. Lookup tables are generated at compile time. With Slices > 1 update
+/// processes Slices bytes per step at the cost of Slices tables.
+///
+/// \tparam Poly    Polynomial
+/// \tparam Init    Initial value
+/// \tparam RefIn   Reflect input bytes
+/// \tparam RefOut  Reflect result
+/// \tparam XorOut  Value to XOR with result
+/// \tparam Slices  Number of tables (1, 4 or 8)
+template<auto Poly,
+         decltype(Poly) Init,
+         bool RefIn,
+         bool RefOut,
+         decltype(Poly) XorOut,
+         size_t Slices = 1uz>
+requires(std::unsigned_integral<decltype(Poly)> &&
+         std::numeric_limits<decltype(Poly)>::digits % 8 == 0 &&
+         (Slices == 1uz || Slices == 4uz || Slices == 8uz))
+struct crc {
+  using value_type = decltype(Poly);
+
+  static constexpr auto width{std::numeric_limits<value_type>::digits};
+
+  /// Lookup tables
+  ///
+  /// Entry i of table k is the CRC of byte i followed by k zero bytes.
+  static constexpr auto tables{
+    detail::make_crc_tables<Poly, RefIn, Slices>()};
+
+  /// Update CRC with a single byte
+  ///
+  /// \param  byte  Byte
+  /// \return Reference to this
+  constexpr crc& update(uint8_t byte) {
+    _crc = detail::crc_next<RefIn>(tables[0uz], _crc, byte);
+    return *this;
+  }
+
+  /// Update CRC with bytes
+  ///
+  /// \param  bytes Bytes
+  /// \return Reference to this
+  constexpr crc& update(std::span<uint8_t const> bytes) {
+    auto first{begin(bytes)};
+    if constexpr (Slices > 1uz)
+      for (; end(bytes) - first >= static_cast<ptrdiff_t>(Slices);
+           first += static_cast<ptrdiff_t>(Slices))
+        _crc = slice(std::span<uint8_t const, Slices>{first, Slices});
+    for (; first != end(bytes); ++first) update(*first);
+    return *this;
+  }
+
+  /// Reset CRC to initial value
+  constexpr void reset() { _crc = init; }
+
+  /// Final CRC value
+  ///
+  /// \return CRC
+  constexpr value_type value() const {
+    if constexpr (RefIn != RefOut)
+      return static_cast<value_type>(reverse_bits(_crc) ^ XorOut);
+    else return static_cast<value_type>(_crc ^ XorOut);
+  }
+
+  /// Compute CRC of bytes
+  ///
+  /// \param  bytes Bytes
+  /// \return CRC
+  static constexpr value_type checksum(std::span<uint8_t const> bytes) {
+    return crc{}.update(bytes).value();
+  }
+
+private:
+  static constexpr value_type init{RefIn ? reverse_bits(Init) : Init};
+
+  /// Feed Slices bytes through tables at once
+  ///
+  /// \param  bytes Bytes
+  /// \return Next CRC register
+  constexpr value_type slice(std::span<uint8_t const, Slices> bytes) const {
+    constexpr auto crc_bytes{static_cast<size_t>(width) / 8uz};
+    value_type retval{};
+    if constexpr (crc_bytes > Slices) {
+      if constexpr (RefIn)
+        retval = static_cast<value_type>(_crc >> 8uz * Slices);
+      else retval = static_cast<value_type>(_crc << 8uz * Slices);
+    }
+    for (auto j{0uz}; j < Slices; ++j) {
+      auto d{bytes[j]};
+      if (j < crc_bytes) {
+        auto const shift{RefIn ? 8uz * j : 8uz * (crc_bytes - 1uz - j)};
+        d ^= static_cast<uint8_t>(_crc >> shift);
+      }
+      retval ^= tables[Slices - 1uz - j][d];
+    }
+    return retval;
+  }
+
+  value_type _crc{init};
+};
+
+/// CRC-8 (e.g. SMBus)
+template<size_t Slices = 1uz>
+using crc8 = crc<uint8_t{0x07u}, uint8_t{}, false, false, uint8_t{}, Slices>;
+
+/// CRC-8/MAXIM (e.g. 1-Wire)
+template<size_t Slices = 1uz>
+using crc8_maxim =
+  crc<uint8_t{0x31u}, uint8_t{}, true, true, uint8_t{}, Slices>;
+
+/// CRC-16/CCITT-FALSE
+template<size_t Slices = 1uz>
+using crc16_ccitt =
+  crc<uint16_t{0x1021u}, uint16_t{0xFFFFu}, false, false, uint16_t{}, Slices>;
+
+/// CRC-32 (e.g. Ethernet, ZIP)
+template<size_t Slices = 1uz>
+using crc32 = crc<uint32_t{0x04C1'1DB7u},
+                  uint32_t{0xFFFF'FFFFu},
+                  true,
+                  true,
+                  uint32_t{0xFFFF'FFFFu},
+                  Slices>;
+
+/// XOR checksum
+///
+/// \param  bytes Bytes
+/// \return XOR of all bytes
+constexpr uint8_t xor_checksum(std::span<uint8_t const> bytes) {
+  uint8_t retval{};
+  for (auto b : bytes) retval ^= b;
+  return retval;
+}
+
+} // namespace ztl
@@ -20,13 +20,18 @@
 
 namespace ztl {
 
-/// Latches T after it was set for at least I ticks
+/// Latches T after it was set for at least a given duration
 ///
 /// \tparam T         Type of latch
 /// \tparam Duration  chrono_duration
-template<std::equality_comparable T, chrono_duration Duration>
+/// \tparam Clock     chrono_clock
+template<std::equality_comparable T,
+         chrono_duration Duration,
+         chrono_clock Clock = std::chrono::steady_clock>
 struct delayed_latch {
   using value_type = T;
+  using clock = Clock;
+  using time_point = Clock::time_point;
 
   /// Default ctor
   constexpr delayed_latch() = default;
@@ -37,23 +42,39 @@ struct delayed_latch {
   /// \param  duration  Duration
   constexpr delayed_latch(value_type const& value,
                           Duration const& duration = {})
-    : _tp{std::chrono::system_clock::now()}, _value{value}, _next_value{value},
+    : _tp{Clock::now()}, _value{value}, _next_value{value},
       _duration{duration} {}
 
   /// Set latch
   ///
   /// \param  value Next value
-  void set(value_type const& value) {
+  /// \return true if latched value changed
+  bool set(value_type const& value) { return set(value, Clock::now()); }
+
+  /// Set latch at a given time
+  ///
+  /// Allows reading the clock only once when updating many latches.
+  ///
+  /// \param  value Next value
+  /// \param  now   Current time
+  /// \return true if latched value changed
+  constexpr bool set(value_type const& value, time_point now) {
     if (_next_value != value) {
-      reset();
+      reset(now);
       _next_value = value;
     }
-    if (std::chrono::system_clock::now() - _tp >= _duration)
-      _value = _next_value;
+    if (now - _tp < _duration || _value == _next_value) return false;
+    _value = _next_value;
+    return true;
   }
 
   /// Reset latch
-  void reset() { _tp = std::chrono::system_clock::now(); }
+  void reset() { reset(Clock::now()); }
+
+  /// Reset latch
+  ///
+  /// \param  now Current time
+  constexpr void reset(time_point now) { _tp = now; }
 
   /// Reset latch
   ///
@@ -78,7 +99,7 @@ struct delayed_latch {
   constexpr operator value_type const&&() const&& { return std::move(value()); }
 
 private:
-  std::chrono::time_point<std::chrono::system_clock> _tp{};
+  time_point _tp{};
   T _value{};
   T _next_value{};
   Duration _duration{};
@@ -38,13 +38,16 @@ struct directional_latch {
   /// Set latch
   ///
   /// \param  value Next value
-  void set(value_type const& value) {
+  /// \return true if latched value changed
+  bool set(value_type const& value) {
     if ((value == _value) || (_less && value > _value) ||
         (!_less && value < _value))
       reset();
     if (!_count) _less = value < _value;
-    if (++_count < I) return;
+    if (++_count < I) return false;
+    auto const retval{_value != value};
     _value = value;
+    return retval;
   }
 
   /// Reset latch
@@ -10,6 +10,10 @@
 
 #pragma once
 
+#include <concepts>
+#include <cstddef>
+#include "inplace_bitset.hpp"
+
 namespace ztl {
 
 /// Detect rising and falling edges
@@ -28,4 +32,52 @@ private:
   bool _value{false};
 };
 
+namespace detail {
+
+template<typename>
+inline constexpr bool is_inplace_bitset_v{false};
+
+template<size_t N>
+inline constexpr bool is_inplace_bitset_v<inplace_bitset<N>>{true};
+
+} // namespace detail
+
+/// Detect rising and falling edges of many inputs at once
+///
+/// Each bit of T is a separate input. Rising and falling edges are returned as
+/// masks and take two bitwise operations each.
+///
+/// \tparam T Type of inputs (unsigned integral or inplace_bitset)
+template<typename T>
+requires(std::unsigned_integral<T> || detail::is_inplace_bitset_v<T>)
+struct basic_edge_detector {
+  using value_type = T;
+
+  /// Masks of inputs which changed
+  struct transitions {
+    value_type rising{};
+    value_type falling{};
+  };
+
+  constexpr basic_edge_detector() = default;
+  explicit constexpr basic_edge_detector(value_type const& value)
+    : _value{value} {}
+
+  [[nodiscard]] constexpr transitions operator()(value_type const& value) {
+    auto const changed{static_cast<value_type>(value ^ _value)};
+    _value = value;
+    return {static_cast<value_type>(changed & value),
+            static_cast<value_type>(changed & ~value)};
+  }
+
+private:
+  value_type _value{};
+};
+
+/// Detect rising and falling edges of N inputs at once
+///
+/// \tparam N Number of inputs
+template<size_t N>
+using edge_detector_bank = basic_edge_detector<inplace_bitset<N>>;
+
 } // namespace ztl
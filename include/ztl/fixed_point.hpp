@@ -0,0 +1,502 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Fixed point
+///
+/// \file   ztl/fixed_point.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "limits.hpp"
+#include "math.hpp"
+#include "type_traits.hpp"
+
+namespace ztl {
+
+/// Signed fixed point number in Q notation (sign bit + IntBits + FracBits)
+///
+/// Addition, subtraction and conversions from integral or floating point
+/// values saturate. Multiplication and division round to nearest and saturate.
+///
+/// \tparam IntBits   Number of integer bits (without sign)
+/// \tparam FracBits  Number of fractional bits
+template<size_t IntBits, size_t FracBits>
+requires(IntBits + FracBits <= 31uz)
+struct fixed {
+  static constexpr auto int_bits{IntBits};
+  static constexpr auto frac_bits{FracBits};
+
+  using value_type = smallest_signed_t<-(1ll << (IntBits + FracBits)),
+                                       (1ll << (IntBits + FracBits)) - 1ll>;
+  using intermediate_type = int64_t;
+
+  static constexpr intermediate_type one{1ll << FracBits};
+  static constexpr intermediate_type min_value{-(1ll << (IntBits + FracBits))};
+  static constexpr intermediate_type max_value{(1ll << (IntBits + FracBits)) -
+                                               1ll};
+
+  /// Default ctor
+  constexpr fixed() = default;
+
+  /// Ctor
+  ///
+  /// \tparam T     Type of value (neither bool nor a character type)
+  /// \param  value Integral value
+  template<std::integral T>
+  requires(!count_type_v<std::remove_cv_t<T>,
+                         bool,
+                         char,
+                         wchar_t,
+                         char8_t,
+                         char16_t,
+                         char32_t>)
+  explicit constexpr fixed(T value)
+    : _value{std::cmp_less(value, min_value >> FracBits)
+               ? saturate(min_value)
+               : std::cmp_greater(value, max_value >> FracBits)
+                   ? saturate(max_value)
+                   : saturate(static_cast<intermediate_type>(value) * one)} {}
+
+  /// Ctor
+  ///
+  /// \tparam T     Type of value
+  /// \param  value Floating point value (NaN results in 0)
+  template<std::floating_point T>
+  explicit constexpr fixed(T value)
+    : _value{value != value
+               ? value_type{}
+               : saturate(static_cast<intermediate_type>(
+                   std::clamp(value * static_cast<T>(one) +
+                                static_cast<T>(value < 0 ? -0.5 : 0.5),
+                              static_cast<T>(min_value),
+                              static_cast<T>(max_value))))} {}
+
+  /// Create fixed point number from raw value
+  ///
+  /// \param  value Raw value
+  /// \return Fixed point number
+  static constexpr fixed from_raw(intermediate_type value) {
+    fixed retval;
+    retval._value = saturate(value);
+    return retval;
+  }
+
+  /// Smallest representable value
+  static constexpr fixed min() { return from_raw(min_value); }
+
+  /// Largest representable value
+  static constexpr fixed max() { return from_raw(max_value); }
+
+  /// Smallest positive value
+  static constexpr fixed epsilon() { return from_raw(1ll); }
+
+  constexpr value_type raw() const { return _value; }
+
+  /// Convert to integral, truncates towards zero
+  template<std::integral T>
+  explicit constexpr operator T() const {
+    return static_cast<T>(_value / one);
+  }
+
+  /// Convert to floating point
+  template<std::floating_point T>
+  explicit constexpr operator T() const {
+    return static_cast<T>(_value) / static_cast<T>(one);
+  }
+
+  constexpr fixed operator+() const { return *this; }
+  constexpr fixed operator-() const {
+    return from_raw(-static_cast<intermediate_type>(_value));
+  }
+
+  constexpr fixed& operator+=(fixed rhs) { return *this = *this + rhs; }
+  constexpr fixed& operator-=(fixed rhs) { return *this = *this - rhs; }
+  constexpr fixed& operator*=(fixed rhs) { return *this = *this * rhs; }
+  constexpr fixed& operator/=(fixed rhs) { return *this = *this / rhs; }
+
+  friend constexpr fixed operator+(fixed lhs, fixed rhs) {
+    return from_raw(static_cast<intermediate_type>(lhs._value) + rhs._value);
+  }
+
+  friend constexpr fixed operator-(fixed lhs, fixed rhs) {
+    return from_raw(static_cast<intermediate_type>(lhs._value) - rhs._value);
+  }
+
+  friend constexpr fixed operator*(fixed lhs, fixed rhs) {
+    auto const product{static_cast<intermediate_type>(lhs._value) *
+                       rhs._value};
+    if constexpr (!FracBits) return from_raw(product);
+    else return from_raw((product + (one >> 1u)) >> FracBits);
+  }
+
+  friend constexpr fixed operator/(fixed lhs, fixed rhs) {
+    assert(rhs._value);
+    auto const dividend{static_cast<intermediate_type>(lhs._value) * one};
+    auto const half{static_cast<intermediate_type>(rhs._value) / 2};
+    return from_raw(((dividend < 0) == (rhs._value < 0) ? dividend + half
+                                                         : dividend - half) /
+                    rhs._value);
+  }
+
+  constexpr auto operator<=>(fixed const&) const = default;
+
+private:
+  static constexpr value_type saturate(intermediate_type value) {
+    return static_cast<value_type>(std::clamp(value, min_value, max_value));
+  }
+
+  value_type _value{};
+};
+
+namespace detail {
+
+/// Division which rounds half away from zero
+///
+/// \param  lhs Dividend
+/// \param  rhs Divisor
+/// \return Rounded quotient
+constexpr int64_t div_round(int64_t lhs, int64_t rhs) {
+  auto const half{rhs / 2};
+  return ((lhs < 0) == (rhs < 0) ? lhs + half : lhs - half) / rhs;
+}
+
+/// Multiplication followed by a division which rounds half away from zero
+///
+/// The product is formed from magnitudes in uint64_t, which can't overflow for
+/// factors of at most 32 bit magnitude. Quotients exceeding the range of any
+/// fixed point number are clamped.
+///
+/// \param  a Factor (|a| < 2^32)
+/// \param  b Factor (|b| < 2^32)
+/// \param  c Divisor
+/// \return Rounded a * b / c
+constexpr int64_t mul_div_round(int64_t a, int64_t b, int64_t c) {
+  auto const magnitude{[](int64_t v) {
+    return v < 0 ? uint64_t{} - static_cast<uint64_t>(v)
+                 : static_cast<uint64_t>(v);
+  }};
+  auto const ua{magnitude(a)};
+  auto const ub{magnitude(b)};
+  auto const uc{magnitude(c)};
+  assert(ua <= 0xFFFF'FFFFull && ub <= 0xFFFF'FFFFull && uc);
+  auto const product{ua * ub};
+  auto const remainder{product % uc};
+  auto const quotient{std::min(product / uc + (remainder >= uc - remainder),
+                               uint64_t{1u} << 62u)};
+  auto const negative{((a < 0) != (b < 0)) != (c < 0)};
+  return negative ? -static_cast<int64_t>(quotient)
+                  : static_cast<int64_t>(quotient);
+}
+
+} // namespace detail
+
+/// Linear interpolation
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  x         Value
+/// \param  x1        Part of interval(x1, x2)
+/// \param  x2        Part of interval(x1, x2)
+/// \param  y1        Part of interval(y1, y2)
+/// \param  y2        Part of interval(y1, y2)
+/// \return Interpolated value
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> lerp(fixed<IntBits, FracBits> x,
+                                        fixed<IntBits, FracBits> x1,
+                                        fixed<IntBits, FracBits> x2,
+                                        fixed<IntBits, FracBits> y1,
+                                        fixed<IntBits, FracBits> y2) {
+  using type = fixed<IntBits, FracBits>;
+  if (x1 == x2) return y1;
+  // Scale raw values without saturating or overflowing the product, raw
+  // differences have at most 32 bit magnitude
+  auto const dx{static_cast<int64_t>(x2.raw()) - x1.raw()};
+  auto const dy{static_cast<int64_t>(y2.raw()) - y1.raw()};
+  auto const dxx{static_cast<int64_t>(x.raw()) - x1.raw()};
+  return type::from_raw(y1.raw() + detail::mul_div_round(dy, dxx, dx));
+}
+
+/// Make an array with N linearly spaced elements between START and END
+///
+/// \tparam N         Number of elements
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  start     First value
+/// \param  end       Last value
+/// \return Linspace array
+template<size_t N, size_t IntBits, size_t FracBits>
+constexpr auto make_linspace(fixed<IntBits, FracBits> start,
+                             fixed<IntBits, FracBits> end) requires(N >= 1u)
+{
+  using type = fixed<IntBits, FracBits>;
+  if constexpr (N == 1u) return end;
+  else {
+    // Step on raw values without saturating the intermediate product
+    auto const diff{static_cast<int64_t>(end.raw()) - start.raw()};
+    std::array<type, N> retval{};
+    for (auto i{0uz}; i < N; ++i)
+      retval[i] = type::from_raw(
+        start.raw() + detail::div_round(static_cast<int64_t>(i) * diff,
+                                        static_cast<int64_t>(N - 1u)));
+    return retval;
+  }
+}
+
+/// Sign
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  value     Value
+/// \return 0         value == 0
+/// \return 1         value > 0
+/// \return -1        value < 0
+template<size_t IntBits, size_t FracBits>
+constexpr int32_t sign(fixed<IntBits, FracBits> value) {
+  return sign(value.raw());
+}
+
+/// Remainder of euclidean division
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  lhs       Dividend
+/// \param  rhs       Divisor
+/// \return lhs modulo rhs
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> euclidean_mod(fixed<IntBits, FracBits> lhs,
+                                                 fixed<IntBits, FracBits> rhs) {
+  return fixed<IntBits, FracBits>::from_raw(
+    euclidean_mod(lhs.raw(), rhs.raw()));
+}
+
+namespace detail {
+
+/// Fractional bits of internal CORDIC values
+inline constexpr auto cordic_frac_bits{30};
+
+/// Convert raw value between numbers of fractional bits with rounding
+///
+/// \param  value Raw value
+/// \param  from  Fractional bits of value
+/// \param  to    Fractional bits of return value
+/// \return Rescaled raw value
+constexpr int64_t rescale(int64_t value, int from, int to) {
+  if (to >= from) return value * (1ll << (to - from));
+  else if (from - to > 62) return 0;
+  auto const shift{from - to};
+  return (value + (1ll << (shift - 1))) >> shift;
+}
+
+/// Constant in internal CORDIC format
+///
+/// \param  value Constant
+/// \return Raw value with cordic_frac_bits fractional bits
+constexpr int64_t cordic_constant(double value) {
+  return round_to_int(value * static_cast<double>(1ll << cordic_frac_bits));
+}
+
+/// Pi in internal CORDIC format
+inline constexpr auto cordic_pi{cordic_constant(pi)};
+
+/// Angles atan(2^-i) of CORDIC iterations
+inline constexpr auto cordic_angles{[] {
+  std::array<int64_t, cordic_frac_bits> retval{};
+  for (auto i{0uz}; i < size(retval); ++i)
+    retval[i] = cordic_constant(atan(1.0 / static_cast<double>(1ull << i)));
+  return retval;
+}()};
+
+/// Reciprocal of CORDIC gain
+inline constexpr auto cordic_gain{[] {
+  auto retval{1.0};
+  for (auto i{0uz}; i < size(cordic_angles); ++i)
+    retval /= sqrt(1.0 + 1.0 / static_cast<double>(1ull << (2uz * i)));
+  return cordic_constant(retval);
+}()};
+
+/// CORDIC in rotation mode
+///
+/// \param  angle Angle with cordic_frac_bits fractional bits
+/// \return Pair of cosine and sine with cordic_frac_bits fractional bits
+constexpr std::pair<int64_t, int64_t> cordic_rotate(int64_t angle) {
+  angle = euclidean_mod<int64_t>(angle + cordic_pi, 2 * cordic_pi) - cordic_pi;
+  auto const flip{angle > cordic_pi / 2 || angle < -cordic_pi / 2};
+  if (angle > cordic_pi / 2) angle = cordic_pi - angle;
+  else if (angle < -cordic_pi / 2) angle = -cordic_pi - angle;
+  int64_t x{cordic_gain};
+  int64_t y{};
+  for (auto i{0uz}; i < size(cordic_angles); ++i) {
+    auto const dx{y >> i};
+    auto const dy{x >> i};
+    if (angle >= 0) {
+      x -= dx;
+      y += dy;
+      angle -= cordic_angles[i];
+    } else {
+      x += dx;
+      y -= dy;
+      angle += cordic_angles[i];
+    }
+  }
+  return {flip ? -x : x, y};
+}
+
+/// CORDIC in vectoring mode
+///
+/// \param  y Y
+/// \param  x X (must not be negative)
+/// \return Angle with cordic_frac_bits fractional bits
+constexpr int64_t cordic_vector(int64_t y, int64_t x) {
+  assert(x >= 0);
+  // Normalize for precision, raw values have at most 32 bits
+  auto const m{static_cast<uint64_t>(std::max(x, y < 0 ? -y : y))};
+  auto const shift{40 - static_cast<int>(std::bit_width(m))};
+  x *= 1ll << shift;
+  y *= 1ll << shift;
+  int64_t angle{};
+  for (auto i{0uz}; i < size(cordic_angles); ++i) {
+    auto const dx{y >> i};
+    auto const dy{x >> i};
+    if (y > 0) {
+      x += dx;
+      y -= dy;
+      angle += cordic_angles[i];
+    } else {
+      x -= dx;
+      y += dy;
+      angle -= cordic_angles[i];
+    }
+  }
+  return angle;
+}
+
+} // namespace detail
+
+/// Sine (CORDIC)
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  x         Angle in radians
+/// \return sin(x)
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> sin(fixed<IntBits, FracBits> x) {
+  constexpr auto frac_bits{static_cast<int>(FracBits)};
+  auto const [c, s]{detail::cordic_rotate(
+    detail::rescale(x.raw(), frac_bits, detail::cordic_frac_bits))};
+  return fixed<IntBits, FracBits>::from_raw(
+    detail::rescale(s, detail::cordic_frac_bits, frac_bits));
+}
+
+/// Cosine (CORDIC)
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  x         Angle in radians
+/// \return cos(x)
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> cos(fixed<IntBits, FracBits> x) {
+  constexpr auto frac_bits{static_cast<int>(FracBits)};
+  auto const [c, s]{detail::cordic_rotate(
+    detail::rescale(x.raw(), frac_bits, detail::cordic_frac_bits))};
+  return fixed<IntBits, FracBits>::from_raw(
+    detail::rescale(c, detail::cordic_frac_bits, frac_bits));
+}
+
+/// Arc tangent of y/x using the signs of both arguments to determine the
+/// quadrant (CORDIC)
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  y         Y
+/// \param  x         X
+/// \return atan2(y, x)
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> atan2(fixed<IntBits, FracBits> y,
+                                         fixed<IntBits, FracBits> x) {
+  if (!x.raw() && !y.raw()) return {};
+  auto const angle{
+    x.raw() >= 0 ? detail::cordic_vector(y.raw(), x.raw())
+    : y.raw() >= 0
+      ? detail::cordic_vector(-static_cast<int64_t>(y.raw()),
+                              -static_cast<int64_t>(x.raw())) +
+          detail::cordic_pi
+      : detail::cordic_vector(-static_cast<int64_t>(y.raw()),
+                              -static_cast<int64_t>(x.raw())) -
+          detail::cordic_pi};
+  return fixed<IntBits, FracBits>::from_raw(detail::rescale(
+    angle, detail::cordic_frac_bits, static_cast<int>(FracBits)));
+}
+
+/// Exponential function
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  x         Value
+/// \return e^x
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> exp(fixed<IntBits, FracBits> x) {
+  constexpr auto one{1ll << detail::cordic_frac_bits};
+  constexpr auto ln2{detail::cordic_constant(detail::ln2_hi + detail::ln2_lo)};
+  constexpr auto frac_bits{static_cast<int>(FracBits)};
+  // x = k * ln2 + r with |r| <= ln2 / 2
+  auto const xq{detail::rescale(x.raw(), frac_bits, detail::cordic_frac_bits)};
+  auto const k{(xq + (xq < 0 ? -ln2 / 2 : ln2 / 2)) / ln2};
+  auto const r{xq - k * ln2};
+  int64_t sum{one};
+  int64_t term{one};
+  for (auto n{1ll}; n <= 12ll; ++n) {
+    term = ((term * r) >> detail::cordic_frac_bits) / n;
+    sum += term;
+  }
+  // e^x = e^r * 2^k
+  auto const shift{k + frac_bits - detail::cordic_frac_bits};
+  if (shift >= 0) {
+    if (shift > 31 || sum > (fixed<IntBits, FracBits>::max_value >> shift))
+      return fixed<IntBits, FracBits>::max();
+    return fixed<IntBits, FracBits>::from_raw(sum << shift);
+  } else if (shift < -62) return {};
+  return fixed<IntBits, FracBits>::from_raw(
+    detail::rescale(sum, static_cast<int>(-shift), 0));
+}
+
+/// Square root
+///
+/// \tparam IntBits   Number of integer bits
+/// \tparam FracBits  Number of fractional bits
+/// \param  x         Value (must not be negative)
+/// \return sqrt(x)
+template<size_t IntBits, size_t FracBits>
+constexpr fixed<IntBits, FracBits> sqrt(fixed<IntBits, FracBits> x) {
+  assert(x.raw() >= 0);
+  if (x.raw() <= 0) return {};
+  // sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F)
+  auto const n{static_cast<uint64_t>(x.raw()) << FracBits};
+  uint64_t root{};
+  uint64_t remainder{n};
+  auto bit{1ull << (static_cast<int>(std::bit_width(n)) & ~1)};
+  if (bit > n) bit >>= 2u;
+  while (bit) {
+    if (remainder >= root + bit) {
+      remainder -= root + bit;
+      root = (root >> 1u) + bit;
+    } else root >>= 1u;
+    bit >>= 2u;
+  }
+  // Round to nearest
+  if (remainder > root) ++root;
+  return fixed<IntBits, FracBits>::from_raw(static_cast<int64_t>(root));
+}
+
+} // namespace ztl
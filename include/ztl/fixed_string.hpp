@@ -11,25 +11,96 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 #include <utility>
 
 namespace ztl {
 
+/// FNV-1a hash
+///
+/// \param  str  String
+/// \param  seed Seed which gets mixed into the offset basis
+/// \return 32 bit FNV-1a hash of str
+constexpr uint32_t fnv1a(std::string_view str, uint32_t seed = 0u) {
+  uint32_t retval{0x811C'9DC5u ^ seed};
+  for (auto c : str) {
+    retval ^= static_cast<uint8_t>(c);
+    retval *= 0x0100'0193u;
+  }
+  return retval;
+}
+
 /// Fixed string
 ///
 /// \tparam I String length
 template<size_t I>
 struct fixed_string {
+  static constexpr auto npos{std::string_view::npos};
+
   constexpr fixed_string() {}
 
   constexpr fixed_string(char const (&str)[I + 1uz]) {
-    std::copy_n(&str[0uz], I, begin(_str));
+    std::copy_n(&str[0uz], I, std::begin(_str));
   }
 
-  constexpr char const* c_str() const { return data(_str); }
+  constexpr char const* c_str() const { return std::data(_str); }
+  constexpr char const* data() const { return std::data(_str); }
+  constexpr char const* begin() const { return std::data(_str); }
+  constexpr char const* end() const { return std::data(_str) + I; }
 
   constexpr auto operator[](size_t i) const { return _str[i]; }
 
+  static constexpr size_t size() { return I; }
+  static constexpr bool empty() { return !I; }
+
+  constexpr operator std::string_view() const { return {data(), I}; }
+
+  /// Find substring
+  ///
+  /// \param  str  Substring to search for
+  /// \param  pos  Position at which to start the search
+  /// \return Position of first character of found substring or npos
+  constexpr size_t find(std::string_view str, size_t pos = 0uz) const {
+    return std::string_view{*this}.find(str, pos);
+  }
+
+  /// Find character
+  ///
+  /// \param  c    Character to search for
+  /// \param  pos  Position at which to start the search
+  /// \return Position of found character or npos
+  constexpr size_t find(char c, size_t pos = 0uz) const {
+    return std::string_view{*this}.find(c, pos);
+  }
+
+  constexpr bool starts_with(std::string_view str) const {
+    return std::string_view{*this}.starts_with(str);
+  }
+
+  constexpr bool ends_with(std::string_view str) const {
+    return std::string_view{*this}.ends_with(str);
+  }
+
+  /// Substring
+  ///
+  /// \tparam Pos    Position of first character
+  /// \tparam Count  Requested length
+  /// \return Substring [Pos, Pos + min(Count, I - Pos))
+  template<size_t Pos, size_t Count = npos>
+  requires(Pos <= I)
+  constexpr auto substr() const {
+    fixed_string<std::min(Count, I - Pos)> retval{};
+    std::copy_n(begin() + Pos, retval.size(), retval._str.begin());
+    return retval;
+  }
+
+  /// FNV-1a hash
+  constexpr uint32_t hash() const { return fnv1a(*this); }
+
   std::array<char, I + 1uz> _str{};
 };
 
@@ -41,13 +112,45 @@ constexpr auto operator""_fs() {
   return Fs;
 }
 
+/// Concatenate fixed strings
+///
+/// \tparam Is...  String lengths
+/// \param  strs   Strings
+/// \return Concatenated string
+template<size_t... Is>
+constexpr auto concat(fixed_string<Is> const&... strs) {
+  fixed_string<(Is + ... + 0uz)> retval{};
+  auto first{retval._str.begin()};
+  ((first = std::copy_n(strs.begin(), strs.size(), first)), ...);
+  return retval;
+}
+
 template<size_t I, size_t J>
 constexpr auto operator+(fixed_string<I> const& lhs,
                          fixed_string<J> const& rhs) {
-  return [&]<size_t... Is, size_t... Js>(std::index_sequence<Is...>,
-                                         std::index_sequence<Js...>) {
-    return fixed_string{{lhs[Is]..., rhs[Js]...}};
-  }(std::make_index_sequence<I>{}, std::make_index_sequence<J + 1uz>{});
+  return concat(lhs, rhs);
+}
+
+template<size_t I, size_t J>
+constexpr bool operator==(fixed_string<I> const& lhs,
+                          fixed_string<J> const& rhs) {
+  return std::string_view{lhs} == std::string_view{rhs};
+}
+
+template<size_t I, size_t J>
+constexpr auto operator<=>(fixed_string<I> const& lhs,
+                           fixed_string<J> const& rhs) {
+  return std::string_view{lhs} <=> std::string_view{rhs};
+}
+
+template<size_t I>
+constexpr bool operator==(fixed_string<I> const& lhs, std::string_view rhs) {
+  return std::string_view{lhs} == rhs;
+}
+
+template<size_t I>
+constexpr auto operator<=>(fixed_string<I> const& lhs, std::string_view rhs) {
+  return std::string_view{lhs} <=> rhs;
 }
 
 } // namespace ztl
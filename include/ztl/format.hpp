@@ -0,0 +1,358 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Format
+///
+/// \file   ztl/format.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include "fail.hpp"
+#include "fixed_string.hpp"
+#include "inplace_string.hpp"
+#include "inplace_vector.hpp"
+#include "string.hpp"
+#include "system_error.hpp"
+
+namespace ztl {
+
+namespace detail {
+
+/// Replacement field of a format string
+struct format_field {
+  size_t literal_first{};  ///< Offset of preceding literal in text
+  size_t literal_size{};   ///< Size of preceding literal
+  int base{10};            ///< Base of integers
+  int precision{-1};       ///< Precision of floating point numbers
+};
+
+/// Not constexpr, calling it during parsing rejects the format string
+inline void invalid_format_string() {}
+
+/// Count replacement fields of format string
+///
+/// \tparam Fmt Format string
+/// \return Number of replacement fields
+template<fixed_string Fmt>
+consteval size_t count_format_fields() {
+  std::string_view const str{Fmt.c_str()};
+  size_t retval{};
+  for (auto i{0uz}; i < size(str); ++i)
+    if (str[i] == '{') {
+      if (i + 1uz < size(str) && str[i + 1uz] == '{') ++i;
+      else ++retval;
+    }
+  return retval;
+}
+
+/// Parsed format string
+///
+/// \tparam N Number of replacement fields
+/// \tparam I Length of format string
+template<size_t N, size_t I>
+struct parsed_format {
+  std::array<char, I + 1uz> text{};          ///< Unescaped literal text
+  std::array<format_field, N + 1uz> fields{}; ///< Fields, last one is a tail
+};
+
+/// Parse format string
+///
+/// Replacement fields have the form {[:[.precision][type]]} where type is
+/// either 'd', 'x' or 'b'. Braces are escaped by doubling them. Invalid format
+/// strings fail constant evaluation.
+///
+/// \tparam Fmt Format string
+/// \return Parsed format string
+template<fixed_string Fmt>
+consteval auto parse_format() {
+  std::string_view const str{Fmt.c_str()};
+  parsed_format<count_format_fields<Fmt>(), Fmt.size()> retval{};
+  size_t text_size{};
+  size_t field{};
+  auto literal_first{0uz};
+  for (auto i{0uz}; i < size(str); ++i) {
+    auto const c{str[i]};
+    if (c == '}') {
+      if (i + 1uz >= size(str) || str[i + 1uz] != '}')
+        invalid_format_string();
+      retval.text[text_size++] = str[++i];
+    } else if (c != '{') retval.text[text_size++] = c;
+    else if (i + 1uz < size(str) && str[i + 1uz] == '{')
+      retval.text[text_size++] = str[++i];
+    else {
+      auto& f{retval.fields[field++]};
+      f.literal_first = literal_first;
+      f.literal_size = text_size - literal_first;
+      literal_first = text_size;
+      if (++i < size(str) && str[i] == ':') {
+        if (++i < size(str) && str[i] == '.') {
+          f.precision = 0;
+          while (++i < size(str) && str[i] >= '0' && str[i] <= '9')
+            f.precision = f.precision * 10 + (str[i] - '0');
+          if (f.precision > 18) invalid_format_string();
+        }
+        if (i < size(str) && str[i] != '}') {
+          switch (str[i++]) {
+            case 'd': f.base = 10; break;
+            case 'x': f.base = 16; break;
+            case 'b': f.base = 2; break;
+            default: invalid_format_string();
+          }
+        }
+      }
+      if (i >= size(str) || str[i] != '}')
+        invalid_format_string();
+    }
+  }
+  retval.fields[field].literal_first = literal_first;
+  retval.fields[field].literal_size = text_size - literal_first;
+  return retval;
+}
+
+/// Parsed format string
+template<fixed_string Fmt>
+inline constexpr auto parsed_format_v{parse_format<Fmt>()};
+
+/// Output buffer of format
+struct format_sink {
+  /// Write characters, truncate on overflow
+  ///
+  /// \param  str Characters
+  constexpr void write(std::string_view str) {
+    auto const n{std::min(size(str), static_cast<size_t>(last - ptr))};
+    ptr = std::copy_n(data(str), n, ptr);
+    overflow |= n < size(str);
+  }
+
+  /// Write single character
+  ///
+  /// \param  c Character
+  constexpr void write(char c) {
+    if (ptr != last) *ptr++ = c;
+    else overflow = true;
+  }
+
+  /// Write integer
+  ///
+  /// \tparam T     Type of value
+  /// \param  value Value
+  /// \param  base  Base
+  template<std::integral T>
+  constexpr void write(T value, int base) {
+    auto const [p, ec]{to_chars(ptr, last, value, base)};
+    if (ec == std::errc{}) ptr = p;
+    else overflow = true;
+  }
+
+  /// Write unsigned integer with leading zeros
+  ///
+  /// \param  value   Value
+  /// \param  digits  Number of digits
+  constexpr void write_zero_padded(uint64_t value, int digits) {
+    std::array<char, 20uz> buf{};
+    auto const p{to_chars(begin(buf), end(buf), value).ptr};
+    for (auto i{p - begin(buf)}; i < digits; ++i) write('0');
+    write(std::string_view{begin(buf), p});
+  }
+
+  char* ptr{};
+  char* last{};
+  bool overflow{};
+};
+
+/// Powers of 10 which fit into uint64_t
+inline constexpr auto powers_of_10{[] {
+  std::array<uint64_t, 20uz> retval{};
+  retval[0uz] = 1u;
+  for (auto i{1uz}; i < size(retval); ++i)
+    retval[i] = retval[i - 1uz] * 10u;
+  return retval;
+}()};
+
+/// Write floating point number
+///
+/// Values are written in fixed notation or in scientific notation once they
+/// exceed the range of uint64_t. The last digit is deliberately rounded half
+/// away from zero from the binary value, which saves the exact decimal
+/// expansion needed for round half to even. Results may therefore differ from
+/// printf and std::format in the last digit, e.g. 2.5 with precision 0 is
+/// written as "3" instead of "2".
+///
+/// \tparam T         Type of value
+/// \param  sink      Output
+/// \param  value     Value
+/// \param  precision Number of fractional digits
+template<std::floating_point T>
+constexpr void write_floating_point(format_sink& sink, T value, int precision) {
+  if (value != value) return sink.write("nan");
+  if (std::signbit(value)) {
+    sink.write('-');
+    value = -value;
+  }
+  if (value == std::numeric_limits<T>::infinity()) return sink.write("inf");
+  int exponent{};
+  auto const scientific{value >= static_cast<T>(1e19)};
+  if (scientific)
+    for (; value >= static_cast<T>(10); ++exponent) value /= static_cast<T>(10);
+  auto integral{static_cast<uint64_t>(value)};
+  auto const scale{powers_of_10[static_cast<size_t>(precision)]};
+  auto fraction{static_cast<uint64_t>(
+    (value - static_cast<T>(integral)) * static_cast<T>(scale) +
+    static_cast<T>(0.5))};
+  if (fraction >= scale) {
+    ++integral;
+    fraction -= scale;
+  }
+  if (scientific && integral >= 10u) {
+    integral /= 10u;
+    ++exponent;
+  }
+  sink.write(integral, 10);
+  if (precision) {
+    sink.write('.');
+    sink.write_zero_padded(fraction, precision);
+  }
+  if (scientific) {
+    sink.write("e+");
+    sink.write_zero_padded(static_cast<uint64_t>(exponent), 2);
+  }
+}
+
+/// Write single argument
+///
+/// \tparam F     Replacement field
+/// \tparam T     Type of argument
+/// \param  sink  Output
+/// \param  arg   Argument
+template<format_field F, typename T>
+constexpr void write_argument(format_sink& sink, T const& arg) {
+  static_assert(F.base == 10 || (std::integral<T> && !std::same_as<T, bool>),
+                "Type 'x' and 'b' require an integer argument");
+  static_assert(F.precision < 0 || std::floating_point<T>,
+                "Precision requires a floating point argument");
+  if constexpr (std::same_as<T, bool>) sink.write(arg ? "true" : "false");
+  else if constexpr (std::same_as<T, char>) sink.write(arg);
+  else if constexpr (std::integral<T>) sink.write(arg, F.base);
+  else if constexpr (std::floating_point<T>)
+    write_floating_point(sink, arg, F.precision < 0 ? 6 : F.precision);
+  else if constexpr (std::same_as<T, error_code>) {
+    if (!arg) sink.write("Success");
+    else if consteval {
+      sink.write("Error");
+    } else {
+      sink.write(strerror(std::to_underlying(static_cast<std::errc>(arg))));
+    }
+  } else if constexpr (requires { arg.c_str(); }) sink.write(arg.c_str());
+  else if constexpr (std::convertible_to<T const&, std::string_view>)
+    sink.write(std::string_view{arg});
+  else fail<T>();
+}
+
+/// Format arguments into sink
+///
+/// \tparam Fmt   Format string
+/// \tparam Ts... Types of arguments
+/// \param  sink  Output
+/// \param  args  Arguments
+template<fixed_string Fmt, typename... Ts>
+constexpr void format_to_sink(format_sink& sink, Ts const&... args) {
+  constexpr auto const& parsed{parsed_format_v<Fmt>};
+  static_assert(size(parsed.fields) == sizeof...(Ts) + 1uz,
+                "Number of arguments doesn't match format string");
+  constexpr auto write_literal{[](format_sink& s, format_field f) {
+    if (f.literal_size)
+      s.write(std::string_view{data(parsed.text) + f.literal_first,
+                               f.literal_size});
+  }};
+  [&]<size_t... Is>(std::index_sequence<Is...>) {
+    ((write_literal(sink, parsed.fields[Is]),
+      write_argument<parsed.fields[Is]>(sink, args)),
+     ...);
+  }(std::index_sequence_for<Ts...>{});
+  write_literal(sink, parsed.fields.back());
+}
+
+} // namespace detail
+
+/// Format arguments into buffer
+///
+/// The format string is parsed at compile time. Replacement fields have the
+/// form {[:[.precision][type]]}, where type is 'd' (default), 'x' or 'b' for
+/// integers and precision is the number of fractional digits of floating point
+/// numbers (default 6). Floating point numbers are rounded half away from
+/// zero, unlike std::format which rounds half to even. Supported arguments are
+/// integers, bool, char, floating point numbers, strings and error_code. The
+/// output is not null-terminated.
+///
+/// \tparam Fmt   Format string
+/// \tparam Ts... Types of arguments
+/// \param  out   Output buffer
+/// \param  args  Arguments
+/// \return Pointer to one past last written character and error code
+///         (std::errc::value_too_large if the output was truncated)
+template<fixed_string Fmt, typename... Ts>
+constexpr std::to_chars_result format(std::span<char> out,
+                                      Ts const&... args) {
+  detail::format_sink sink{data(out), data(out) + size(out)};
+  detail::format_to_sink<Fmt>(sink, args...);
+  return {sink.ptr,
+          sink.overflow ? std::errc::value_too_large : std::errc{}};
+}
+
+/// Format arguments and append them to inplace_vector
+///
+/// \tparam Fmt   Format string
+/// \tparam I     Capacity of inplace_vector
+/// \tparam Ts... Types of arguments
+/// \param  out   Output
+/// \param  args  Arguments
+/// \return std::errc::value_too_large if the output was truncated
+template<fixed_string Fmt, size_t I, typename... Ts>
+constexpr std::errc format(inplace_vector<char, I>& out, Ts const&... args) {
+  // Write into the unused capacity directly and only grow afterwards
+  auto const first{size(out)};
+  auto const [ptr, ec]{
+    format<Fmt>(std::span{data(out) + first, I - first}, args...)};
+  out.resize(static_cast<decltype(first)>(ptr - data(out)));
+  return ec;
+}
+
+/// Format arguments and append them to inplace_string
+///
+/// \tparam Fmt   Format string
+/// \tparam I     Capacity of inplace_string
+/// \tparam Ts... Types of arguments
+/// \param  out   Output
+/// \param  args  Arguments
+/// \return std::errc::value_too_large if the output was truncated
+template<fixed_string Fmt, size_t I, typename... Ts>
+constexpr std::errc format(inplace_string<I>& out, Ts const&... args) {
+  auto const first{size(out)};
+  auto retval{std::errc{}};
+  out.resize_and_overwrite(static_cast<decltype(first)>(I),
+                           [&](char* ptr, size_t count) {
+                             auto const [last, ec]{format<Fmt>(
+                               std::span{ptr + first, count - first}, args...)};
+                             retval = ec;
+                             return last - ptr;
+                           });
+  return retval;
+}
+
+} // namespace ztl
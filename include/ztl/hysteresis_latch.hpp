@@ -0,0 +1,107 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Hysteresis latch
+///
+/// \file   ztl/hysteresis_latch.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include "limits.hpp"
+
+namespace ztl {
+
+/// Latches true after samples reached an upper threshold and false after they
+/// fell below a lower threshold for at least I times (Schmitt trigger)
+///
+/// With I = 1 this is a plain Schmitt trigger. Larger values of I additionally
+/// debounce the thresholds, i.e. a threshold has to be crossed by I consecutive
+/// samples. Since the lower threshold is exclusive, samples equal to both
+/// thresholds (e.g. of a default constructed latch) can't make the latch
+/// oscillate. Unordered samples (NaN) never cross a threshold.
+///
+/// \tparam T Type of samples
+/// \tparam I Times to latch
+template<std::totally_ordered T, size_t I = 1uz>
+requires(I > 0uz)
+struct hysteresis_latch {
+  using input_type = T;
+  using value_type = bool;
+
+  /// Default ctor
+  constexpr hysteresis_latch() = default;
+
+  /// Ctor
+  ///
+  /// \param  lower Lower threshold
+  /// \param  upper Upper threshold
+  /// \param  value Initial value
+  constexpr hysteresis_latch(input_type const& lower,
+                             input_type const& upper,
+                             value_type value = false)
+    : _lower{lower}, _upper{upper}, _value{value} {
+    assert(!(upper < lower));
+  }
+
+  /// Set latch
+  ///
+  /// \param  sample  Next sample
+  /// \return true if latched value changed
+  bool set(input_type const& sample) {
+    bool const crossed{_value ? sample < _lower : _upper <= sample};
+    if constexpr (I == 1uz) {
+      _value ^= crossed;
+      return crossed;
+    } else {
+      _count = static_cast<decltype(_count)>((_count + 1u) * crossed);
+      bool const latch{_count >= I};
+      _value ^= latch;
+      _count = static_cast<decltype(_count)>(_count * !latch);
+      return latch;
+    }
+  }
+
+  /// Reset latch
+  void reset() { _count = 0u; }
+
+  /// Reset latch
+  ///
+  /// Only accepts bool, so that a sample passed by mistake (e.g. reset(0))
+  /// doesn't silently convert.
+  ///
+  /// \param  value Reset value
+  void reset(std::same_as<value_type> auto value) {
+    reset();
+    _value = value;
+  }
+
+  /// Reset latch
+  ///
+  /// \param  lower Lower threshold
+  /// \param  upper Upper threshold
+  void reset(input_type const& lower, input_type const& upper) {
+    assert(!(upper < lower));
+    reset();
+    _lower = lower;
+    _upper = upper;
+  }
+
+  constexpr value_type value() const { return _value; }
+
+  constexpr operator value_type() const { return value(); }
+
+private:
+  T _lower{};
+  T _upper{};
+  smallest_unsigned_t<I> _count{};
+  bool _value{};
+};
+
+} // namespace ztl
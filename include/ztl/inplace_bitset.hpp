@@ -0,0 +1,288 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Inplace bitset
+///
+/// \file   ztl/inplace_bitset.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include "limits.hpp"
+
+namespace ztl {
+
+/// Fixed-size bitset with word-parallel scan operations
+///
+/// Bitsets which fit into a single word use the smallest unsigned type which
+/// holds N bits. Larger bitsets use an array of size_t words. Iterating a
+/// bitset yields the indices of all set bits.
+///
+/// \tparam N Number of bits
+template<size_t N>
+requires(N > 0uz)
+struct inplace_bitset {
+  using word_type =
+    std::conditional_t<(N <= std::numeric_limits<size_t>::digits),
+                       smallest_unsigned_t<(N >= 64uz ? ~0ull
+                                                      : (1ull << N) - 1ull)>,
+                       size_t>;
+
+  static constexpr auto word_bits{
+    static_cast<size_t>(std::numeric_limits<word_type>::digits)};
+  static constexpr auto words{(N + word_bits - 1uz) / word_bits};
+
+  /// Iterator over indices of set bits
+  struct iterator {
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr iterator() = default;
+    constexpr iterator(inplace_bitset const* ptr, size_t i)
+      : _ptr{ptr}, _i{i} {}
+
+    constexpr value_type operator*() const { return _i; }
+
+    constexpr iterator& operator++() {
+      _i = _ptr->find_next(_i);
+      return *this;
+    }
+
+    constexpr iterator operator++(int) {
+      iterator retval{*this};
+      ++*this;
+      return retval;
+    }
+
+    constexpr bool operator==(iterator const& rhs) const {
+      return _i == rhs._i;
+    }
+
+  private:
+    inplace_bitset const* _ptr{};
+    size_t _i{N};
+  };
+
+  using const_iterator = iterator;
+
+  // Construct/copy/destroy
+  constexpr inplace_bitset() = default;
+
+  /// Ctor
+  ///
+  /// \param  value Initial value of the lowest bits
+  constexpr inplace_bitset(unsigned long long value) {
+    for (auto i{0uz}; i < words && value; ++i) {
+      _data[i] = static_cast<word_type>(value);
+      value = word_bits < 64uz ? value >> (word_bits % 64uz) : 0ull;
+    }
+    _data[words - 1uz] &= last_word_mask;
+  }
+
+  // Iterators
+  constexpr iterator begin() const { return iterator{this, find_first()}; }
+  constexpr iterator end() const { return iterator{this, N}; }
+  constexpr const_iterator cbegin() const { return begin(); }
+  constexpr const_iterator cend() const { return end(); }
+
+  // Capacity
+  constexpr size_t size() const { return N; }
+
+  // Element access
+  constexpr bool operator[](size_t i) const { return test(i); }
+  constexpr bool test(size_t i) const {
+    assert(i < N);
+    return _data[i / word_bits] & bit(i);
+  }
+  constexpr bool all() const { return count() == N; }
+  constexpr bool any() const {
+    return std::ranges::any_of(_data, [](word_type w) { return w != 0u; });
+  }
+  constexpr bool none() const { return !any(); }
+  constexpr size_t count() const {
+    size_t retval{};
+    for (auto w : _data) retval += static_cast<size_t>(std::popcount(w));
+    return retval;
+  }
+
+  /// Find first set bit
+  ///
+  /// \return Index of first set bit or N if none
+  constexpr size_t find_first() const { return scan<false>(0uz); }
+
+  /// Find next set bit
+  ///
+  /// \param  i Index to start after
+  /// \return Index of next set bit after i or N if none
+  constexpr size_t find_next(size_t i) const { return scan<false>(i + 1uz); }
+
+  /// Find first unset bit
+  ///
+  /// \return Index of first unset bit or N if none
+  constexpr size_t find_first_unset() const { return scan<true>(0uz); }
+
+  /// Find next unset bit
+  ///
+  /// \param  i Index to start after
+  /// \return Index of next unset bit after i or N if none
+  constexpr size_t find_next_unset(size_t i) const {
+    return scan<true>(i + 1uz);
+  }
+
+  // Modifiers
+  constexpr inplace_bitset& set() {
+    std::ranges::fill(_data, std::numeric_limits<word_type>::max());
+    _data[words - 1uz] &= last_word_mask;
+    return *this;
+  }
+  constexpr inplace_bitset& set(size_t i, bool value = true) {
+    assert(i < N);
+    if (value) _data[i / word_bits] |= bit(i);
+    else _data[i / word_bits] &= static_cast<word_type>(~bit(i));
+    return *this;
+  }
+  constexpr inplace_bitset& reset() {
+    std::ranges::fill(_data, word_type{});
+    return *this;
+  }
+  constexpr inplace_bitset& reset(size_t i) { return set(i, false); }
+  constexpr inplace_bitset& flip() {
+    for (auto& w : _data) w = static_cast<word_type>(~w);
+    _data[words - 1uz] &= last_word_mask;
+    return *this;
+  }
+  constexpr inplace_bitset& flip(size_t i) {
+    assert(i < N);
+    _data[i / word_bits] ^= bit(i);
+    return *this;
+  }
+
+  /// Set bits in range [first, last)
+  ///
+  /// \param  first First bit
+  /// \param  last  One past last bit
+  constexpr inplace_bitset& set_range(size_t first, size_t last) {
+    return range<true>(first, last);
+  }
+
+  /// Reset bits in range [first, last)
+  ///
+  /// \param  first First bit
+  /// \param  last  One past last bit
+  constexpr inplace_bitset& reset_range(size_t first, size_t last) {
+    return range<false>(first, last);
+  }
+
+  // Data access
+  constexpr word_type const* data() const { return std::data(_data); }
+
+  // Bitwise operators
+  constexpr inplace_bitset& operator&=(inplace_bitset const& rhs) {
+    for (auto i{0uz}; i < words; ++i) _data[i] &= rhs._data[i];
+    return *this;
+  }
+  constexpr inplace_bitset& operator|=(inplace_bitset const& rhs) {
+    for (auto i{0uz}; i < words; ++i) _data[i] |= rhs._data[i];
+    return *this;
+  }
+  constexpr inplace_bitset& operator^=(inplace_bitset const& rhs) {
+    for (auto i{0uz}; i < words; ++i) _data[i] ^= rhs._data[i];
+    return *this;
+  }
+  constexpr inplace_bitset operator~() const {
+    return inplace_bitset{*this}.flip();
+  }
+
+  // Non-member functions
+  friend constexpr inplace_bitset operator&(inplace_bitset lhs,
+                                            inplace_bitset const& rhs) {
+    return lhs &= rhs;
+  }
+  friend constexpr inplace_bitset operator|(inplace_bitset lhs,
+                                            inplace_bitset const& rhs) {
+    return lhs |= rhs;
+  }
+  friend constexpr inplace_bitset operator^(inplace_bitset lhs,
+                                            inplace_bitset const& rhs) {
+    return lhs ^= rhs;
+  }
+  friend constexpr bool operator==(inplace_bitset const&,
+                                   inplace_bitset const&) = default;
+
+private:
+  static constexpr word_type last_word_mask{
+    N % word_bits ? static_cast<word_type>((word_type{1u} << (N % word_bits)) -
+                                           1u)
+                  : std::numeric_limits<word_type>::max()};
+
+  static constexpr word_type bit(size_t i) {
+    return static_cast<word_type>(word_type{1u} << (i % word_bits));
+  }
+
+  /// Mask of all bits from i % word_bits upwards
+  static constexpr word_type bits_from(size_t i) {
+    return static_cast<word_type>(std::numeric_limits<word_type>::max()
+                                  << (i % word_bits));
+  }
+
+  /// Find first set (or unset) bit starting at i
+  ///
+  /// \tparam Unset Search for unset bits
+  /// \param  i     Index to start at
+  /// \return Index of found bit or N if none
+  template<bool Unset>
+  constexpr size_t scan(size_t i) const {
+    if (i >= N) return N;
+    auto w{i / word_bits};
+    auto word{static_cast<word_type>((Unset ? ~_data[w] : _data[w]) &
+                                     bits_from(i))};
+    for (;;) {
+      if (word)
+        return std::min(
+          w * word_bits + static_cast<size_t>(std::countr_zero(word)), N);
+      if (++w >= words) return N;
+      word = static_cast<word_type>(Unset ? ~_data[w] : _data[w]);
+    }
+  }
+
+  /// Set or reset bits in range [first, last)
+  ///
+  /// \tparam Value Set or reset
+  /// \param  first First bit
+  /// \param  last  One past last bit
+  template<bool Value>
+  constexpr inplace_bitset& range(size_t first, size_t last) {
+    assert(first <= last && last <= N);
+    if (first == last) return *this;
+    auto const first_word{first / word_bits};
+    auto const last_word{(last - 1uz) / word_bits};
+    for (auto w{first_word}; w <= last_word; ++w) {
+      auto mask{std::numeric_limits<word_type>::max()};
+      if (w == first_word) mask &= bits_from(first);
+      if (w == last_word)
+        mask &= static_cast<word_type>(~bits_from(last - 1uz) |
+                                       bit(last - 1uz));
+      if constexpr (Value) _data[w] |= mask;
+      else _data[w] &= static_cast<word_type>(~mask);
+    }
+    return *this;
+  }
+
+  std::array<word_type, words> _data{};
+};
+
+} // namespace ztl
@@ -15,7 +15,9 @@
 #include <bit>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 #include "limits.hpp"
 #include "math.hpp"
 
@@ -93,13 +95,11 @@ struct inplace_deque {
     }
 
     constexpr _iterator operator+(difference_type n) const {
-      auto const i{euclidean_mod<difference_type>(_i + n, I + 1uz)};
-      return _iterator{_ptr, static_cast<size_type>(i)};
+      return _iterator{_ptr, advance(_i, n)};
     }
 
     constexpr _iterator& operator+=(difference_type n) {
-      _i =
-        static_cast<size_type>(euclidean_mod<difference_type>(_i + n, I + 1uz));
+      _i = advance(_i, n);
       return *this;
     }
 
@@ -110,13 +110,11 @@ struct inplace_deque {
     }
 
     constexpr _iterator operator-(difference_type n) const {
-      auto const i{euclidean_mod<difference_type>(_i - n, I + 1uz)};
-      return _iterator{_ptr, static_cast<size_type>(i)};
+      return _iterator{_ptr, advance(_i, -n)};
     }
 
     constexpr _iterator& operator-=(difference_type n) {
-      _i =
-        static_cast<size_type>(euclidean_mod<difference_type>(_i - n, I + 1uz));
+      _i = advance(_i, -n);
       return *this;
     }
 
@@ -157,6 +155,29 @@ struct inplace_deque {
     }
 
   private:
+    /// Index n elements away from index i
+    ///
+    /// The magnitude of the offset is reduced as unsigned value, so
+    /// euclidean_mod can avoid the division for offsets which fit 32 bit.
+    /// Larger offsets are reduced with a full width modulo. The sign is applied
+    /// afterwards with a single conditional wrap.
+    ///
+    /// \param  i Index
+    /// \param  n Offset
+    /// \return Index
+    static constexpr size_type advance(size_type i, difference_type n) {
+      using U = std::make_unsigned_t<difference_type>;
+      auto const magnitude{n < 0 ? U{} - static_cast<U>(n)
+                                 : static_cast<U>(n)};
+      auto const m{
+        std::in_range<uint32_t>(magnitude)
+          ? euclidean_mod<I + 1uz>(static_cast<uint32_t>(magnitude))
+          : static_cast<uint32_t>(magnitude % (I + 1uz))};
+      if (n < 0) return static_cast<size_type>(i >= m ? i - m : i + I + 1u - m);
+      auto const j{i + m};
+      return static_cast<size_type>(j > I ? j - I - 1u : j);
+    }
+
     inplace_deque_pointer _ptr{};
     size_type _i{};
   };
@@ -0,0 +1,250 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Inplace string
+///
+/// \file   ztl/inplace_string.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "fixed_string.hpp"
+#include "limits.hpp"
+
+namespace ztl {
+
+/// Stack allocated string with fixed capacity
+///
+/// Characters are stored inplace followed by a null terminator which is kept
+/// up to date by all modifiers, so c_str() can be passed to the functions of
+/// string.hpp without copying.
+///
+/// \tparam I Capacity of string (excluding null terminator)
+template<size_t I>
+struct inplace_string {
+  // Types
+  using value_type = char;
+  using size_type = smallest_unsigned_t<I>;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = value_type const&;
+  using pointer = value_type*;
+  using const_pointer = value_type const*;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr auto npos{std::string_view::npos};
+
+  // Construct/copy/destroy
+  constexpr inplace_string() = default;
+  constexpr inplace_string(std::string_view str) { append(str); }
+  constexpr inplace_string(char const* str)
+    : inplace_string{std::string_view{str}} {}
+
+  // Iterators
+  constexpr iterator begin() { return std::data(_data); }
+  constexpr const_iterator begin() const { return std::data(_data); }
+  constexpr iterator end() { return begin() + size(); }
+  constexpr const_iterator end() const { return begin() + size(); }
+  constexpr reverse_iterator rbegin() { return reverse_iterator{end()}; }
+  constexpr const_reverse_iterator rbegin() const {
+    return const_reverse_iterator{end()};
+  }
+  constexpr reverse_iterator rend() { return reverse_iterator{begin()}; }
+  constexpr const_reverse_iterator rend() const {
+    return const_reverse_iterator{begin()};
+  }
+
+  constexpr const_iterator cbegin() const { return begin(); }
+  constexpr const_iterator cend() const { return end(); }
+  constexpr const_reverse_iterator crbegin() const { return rbegin(); }
+  constexpr const_reverse_iterator crend() const { return rend(); }
+
+  // Capacity
+  constexpr bool empty() const { return size() == 0uz; }
+  constexpr bool full() const { return size() == I; }
+  constexpr size_type size() const { return _size; }
+  constexpr size_type length() const { return _size; }
+  constexpr size_type max_size() const { return I; }
+  constexpr size_type capacity() const { return I; }
+  constexpr void resize(size_type count, value_type c = '\0') {
+    assert(count <= I);
+    if (count > _size) std::fill(end(), begin() + count, c);
+    terminate(count);
+  }
+
+  /// Resize string and overwrite its contents
+  ///
+  /// Calls op(data(), count) which may write up to count characters and returns
+  /// the new size of the string. Unlike resize(), characters past the old size
+  /// aren't filled first, so buffers which get overwritten anyway cost nothing.
+  ///
+  /// \tparam Op    Type of operation
+  /// \param  count Maximum size of string
+  /// \param  op    Operation
+  template<typename Op>
+  requires std::integral<std::invoke_result_t<Op, pointer, size_type>>
+  constexpr void resize_and_overwrite(size_type count, Op op) {
+    assert(count <= I);
+    auto const n{std::move(op)(data(), count)};
+    assert(std::cmp_greater_equal(n, 0) && std::cmp_less_equal(n, count));
+    terminate(static_cast<size_type>(n));
+  }
+
+  // Element access
+  constexpr reference operator[](size_type i) { return _data[i]; }
+  constexpr const_reference operator[](size_type i) const { return _data[i]; }
+  constexpr reference front() { return _data[0uz]; }
+  constexpr const_reference front() const { return _data[0uz]; }
+  constexpr reference back() { return _data[_size - 1uz]; }
+  constexpr const_reference back() const { return _data[_size - 1uz]; }
+
+  // Data access
+  constexpr pointer data() { return std::data(_data); }
+  constexpr const_pointer data() const { return std::data(_data); }
+  constexpr const_pointer c_str() const { return std::data(_data); }
+  constexpr operator std::string_view() const { return {data(), size()}; }
+
+  // Modifiers
+  constexpr inplace_string& append(std::string_view str) {
+    assert(std::size(str) <= I - size());
+    std::ranges::copy(str, end());
+    terminate(static_cast<size_type>(size() + std::size(str)));
+    return *this;
+  }
+  constexpr inplace_string& append(size_type count, value_type c) {
+    assert(count <= I - size());
+    std::fill_n(end(), count, c);
+    terminate(static_cast<size_type>(size() + count));
+    return *this;
+  }
+  constexpr inplace_string& operator+=(std::string_view str) {
+    return append(str);
+  }
+  constexpr inplace_string& operator+=(value_type c) {
+    push_back(c);
+    return *this;
+  }
+  constexpr void push_back(value_type c) {
+    assert(!full());
+    _data[_size++] = c;
+    _data[_size] = '\0';
+  }
+  constexpr void pop_back() {
+    assert(!empty());
+    _data[--_size] = '\0';
+  }
+  constexpr void clear() { terminate(0u); }
+
+  // Operations
+  constexpr size_t find(std::string_view str, size_t pos = 0uz) const {
+    return std::string_view{*this}.find(str, pos);
+  }
+  constexpr size_t find(value_type c, size_t pos = 0uz) const {
+    return std::string_view{*this}.find(c, pos);
+  }
+  constexpr bool starts_with(std::string_view str) const {
+    return std::string_view{*this}.starts_with(str);
+  }
+  constexpr bool ends_with(std::string_view str) const {
+    return std::string_view{*this}.ends_with(str);
+  }
+
+private:
+  constexpr void terminate(size_type count) {
+    _size = count;
+    _data[_size] = '\0';
+  }
+
+  std::array<value_type, I + 1uz> _data{};
+  smallest_unsigned_t<I> _size{};
+};
+
+template<size_t I>
+inplace_string(char const (&)[I]) -> inplace_string<I - 1uz>;
+
+template<size_t I>
+inplace_string(fixed_string<I>) -> inplace_string<I>;
+
+// Non-member functions
+template<size_t I, size_t J>
+constexpr bool operator==(inplace_string<I> const& lhs,
+                          inplace_string<J> const& rhs) {
+  return std::string_view{lhs} == std::string_view{rhs};
+}
+
+template<size_t I, size_t J>
+constexpr auto operator<=>(inplace_string<I> const& lhs,
+                           inplace_string<J> const& rhs) {
+  return std::string_view{lhs} <=> std::string_view{rhs};
+}
+
+template<size_t I>
+constexpr bool operator==(inplace_string<I> const& lhs, std::string_view rhs) {
+  return std::string_view{lhs} == rhs;
+}
+
+template<size_t I>
+constexpr auto operator<=>(inplace_string<I> const& lhs, std::string_view rhs) {
+  return std::string_view{lhs} <=> rhs;
+}
+
+// Iterators
+template<size_t I>
+constexpr auto begin(inplace_string<I>& c) -> decltype(c.begin()) {
+  return c.begin();
+}
+template<size_t I>
+constexpr auto begin(inplace_string<I> const& c) -> decltype(c.begin()) {
+  return c.begin();
+}
+template<size_t I>
+constexpr auto end(inplace_string<I>& c) -> decltype(c.end()) {
+  return c.end();
+}
+template<size_t I>
+constexpr auto end(inplace_string<I> const& c) -> decltype(c.end()) {
+  return c.end();
+}
+
+// Capacity
+template<size_t I>
+[[nodiscard]] constexpr auto empty(inplace_string<I> const& c)
+  -> decltype(c.empty()) {
+  return c.empty();
+}
+template<size_t I>
+[[nodiscard]] constexpr auto full(inplace_string<I> const& c)
+  -> decltype(c.full()) {
+  return c.full();
+}
+template<size_t I>
+constexpr auto size(inplace_string<I> const& c) -> decltype(c.size()) {
+  return c.size();
+}
+
+// Data access
+template<size_t I>
+constexpr auto data(inplace_string<I>& c) -> decltype(c.data()) {
+  return c.data();
+}
+template<size_t I>
+constexpr auto data(inplace_string<I> const& c) -> decltype(c.data()) {
+  return c.data();
+}
+
+} // namespace ztl
@@ -10,37 +10,89 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace ztl {
 
+/// Align value up to power of 2 alignment
+///
+/// \tparam T         Type of values
+/// \param  alignment Alignment (must be a power of 2)
+/// \param  value     Value to align
+/// \return Aligned value
+template<std::unsigned_integral T>
+constexpr T align_up(T alignment, T value) {
+  assert(std::has_single_bit(alignment));
+  return static_cast<T>((value + alignment - 1u) & ~(alignment - 1u));
+}
+
+/// Align value down to power of 2 alignment
+///
+/// \tparam T         Type of values
+/// \param  alignment Alignment (must be a power of 2)
+/// \param  value     Value to align
+/// \return Aligned value
+template<std::unsigned_integral T>
+constexpr T align_down(T alignment, T value) {
+  assert(std::has_single_bit(alignment));
+  return static_cast<T>(value & ~(alignment - 1u));
+}
+
 /// Align value to alignment
 ///
 /// \param  alignment Alignment
 /// \param  value     Value to align
 /// \return Aligned value
 constexpr size_t align(size_t alignment, size_t value) {
+  if (std::has_single_bit(alignment)) return align_up(alignment, value);
   return value + (alignment - value % alignment) % alignment;
 }
 
+namespace detail {
+
+/// Unsigned version of T which is at least as wide as uint32_t
+template<std::integral T>
+using at_least_uint32_t = std::conditional_t<(sizeof(T) > sizeof(uint32_t)),
+                                             std::make_unsigned_t<T>,
+                                             uint32_t>;
+
+} // namespace detail
+
 /// Log2 floor
 ///
-/// \param  value Value
+/// \tparam T     Type of value
+/// \param  value Value (> 0)
 /// \return floor(log2(n))
-constexpr uint32_t floor_log2(uint32_t value) {
-  return value == 1u ? 0u : 1u + floor_log2(value >> 1u);
+template<std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr uint32_t floor_log2(T value) {
+  assert(value > 0);
+  return static_cast<uint32_t>(
+    std::bit_width(static_cast<std::make_unsigned_t<T>>(value)) - 1);
 }
 
 /// Log2 ceil
 ///
-/// \param  value Value
+/// \tparam T     Type of value
+/// \param  value Value (> 0)
 /// \return ceil(log2(n))
-constexpr uint32_t ceil_log2(uint32_t value) {
-  return value == 1u ? 0u : floor_log2(value - 1u) + 1u;
+template<std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr uint32_t ceil_log2(T value) {
+  assert(value > 0);
+  return static_cast<uint32_t>(
+    std::bit_width(static_cast<std::make_unsigned_t<T>>(value - 1)));
 }
 
 /// Linear interpolation
@@ -60,14 +112,52 @@ constexpr T lerp(T x, T x1, T x2, T y1, T y2) {
   return y1 + ((y2 - y1) * (x - x1)) / (x2 - x1);
 }
 
+/// Linear interpolation of multiple values
+///
+/// Equals calling the scalar version for each element but lets the compiler
+/// vectorize the loop.
+///
+/// \tparam T   Type of values
+/// \param  x   Values
+/// \param  x1  Part of interval(x1, x2)
+/// \param  x2  Part of interval(x1, x2)
+/// \param  y1  Part of interval(y1, y2)
+/// \param  y2  Part of interval(y1, y2)
+/// \param  y   Interpolated values (at least as many as x)
+template<typename T>
+requires std::integral<T> || std::floating_point<T>
+constexpr void lerp(std::type_identity_t<std::span<T const>> x,
+                    T x1,
+                    T x2,
+                    T y1,
+                    T y2,
+                    std::type_identity_t<std::span<T>> y) {
+  assert(size(x) <= size(y));
+  if constexpr (std::integral<T>)
+    if (x1 == x2) {
+      std::fill_n(begin(y), size(x), y1);
+      return;
+    }
+  auto const dy{y2 - y1};
+  auto const dx{x2 - x1};
+  for (auto i{0uz}; i < size(x); ++i)
+    y[i] = static_cast<T>(y1 + (dy * (x[i] - x1)) / dx);
+}
+
 /// Power of 2
 ///
+/// The result is at least as wide as uint32_t, so pow2(uint8_t{10}) is 1024.
+///
+/// \tparam T     Type of value
 /// \param  value Value
 /// \return 2^n
-constexpr uint32_t pow2(uint32_t value) {
-  uint32_t result{1u};
-  for (uint32_t i{0u}; i < value; ++i) result <<= 1u;
-  return result;
+template<std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr detail::at_least_uint32_t<T> pow2(T value) {
+  using R = detail::at_least_uint32_t<T>;
+  assert(std::cmp_greater_equal(value, 0) &&
+         std::cmp_less(value, std::numeric_limits<R>::digits));
+  return static_cast<R>(R{1u} << value);
 }
 
 /// Sign
@@ -95,13 +185,13 @@ template<size_t N, typename T>
 constexpr auto make_linspace(T start, T end) requires(N >= 1u)
 {
   if constexpr (N == 1u) return end;
-  else
-    return std::invoke(
-      [&]<size_t... Is>(std::index_sequence<Is...>) {
-        return std::array<T, N>{start + static_cast<T>(Is) * (end - start) /
-                                          static_cast<T>(N - 1u)...};
-      },
-      std::make_index_sequence<N>{});
+  else {
+    std::array<T, N> retval{};
+    for (auto i{0uz}; i < N; ++i)
+      retval[i] =
+        start + static_cast<T>(i) * (end - start) / static_cast<T>(N - 1u);
+    return retval;
+  }
 }
 
 /// Remainder of euclidean division
@@ -115,8 +205,63 @@ constexpr auto make_linspace(T start, T end) requires(N >= 1u)
 template<std::integral T>
 constexpr T euclidean_mod(T lhs, T rhs) {
   assert(rhs != 0);
-  T const m{lhs % rhs};
-  return std::unsigned_integral<T> ? m : m >= 0 ? m : m + std::abs(rhs);
+  auto const m{static_cast<T>(lhs % rhs)};
+  if constexpr (std::unsigned_integral<T>) return m;
+  else return m >= 0 ? m : static_cast<T>(m + (rhs < 0 ? -rhs : rhs));
+}
+
+/// Remainder of euclidean division by a constant divisor
+///
+/// Power of 2 divisors result in a single mask. Other divisors use Lemire's
+/// fastmod for unsigned types which fit in half the width of the widest
+/// available multiplication. 32 bit types with divisors of at most 16 bit get
+/// by with 64 bit multiplications, so they avoid the division on targets
+/// without a 128 bit type as well. Other 32 bit divisors require unsigned
+/// __int128 and otherwise fall back to %.
+///
+/// https://arxiv.org/abs/1902.01961
+///
+/// \tparam D   Divisor
+/// \tparam T   Type of dividend
+/// \param  lhs Dividend
+/// \return lhs modulo D
+template<auto D, std::integral T>
+requires(std::integral<decltype(D)> && D > 0 &&
+         std::cmp_less_equal(D, std::numeric_limits<T>::max()))
+constexpr T euclidean_mod(T lhs) {
+  using U = std::make_unsigned_t<T>;
+  if constexpr (std::has_single_bit(static_cast<U>(D)))
+    return static_cast<T>(static_cast<U>(lhs) & static_cast<U>(D - 1));
+  else if constexpr (std::signed_integral<T>) {
+    auto const m{static_cast<T>(lhs % static_cast<T>(D))};
+    return m >= 0 ? m : static_cast<T>(m + static_cast<T>(D));
+  } else if constexpr (sizeof(T) <= sizeof(uint16_t)) {
+    constexpr auto m{
+      static_cast<uint32_t>(std::numeric_limits<uint32_t>::max() / D + 1u)};
+    auto const lowbits{m * static_cast<uint32_t>(lhs)};
+    return static_cast<T>((static_cast<uint64_t>(lowbits) *
+                           static_cast<uint64_t>(D)) >>
+                          32u);
+  } else if constexpr (sizeof(T) <= sizeof(uint32_t) &&
+                       std::cmp_less_equal(D, 0xFFFFu)) {
+    // 48 fractional bits suffice for 32 bit dividends and 16 bit divisors
+    constexpr auto mask{(uint64_t{1u} << 48u) - 1u};
+    constexpr auto m{static_cast<uint64_t>(mask / D + 1u)};
+    auto const lowbits{(m * static_cast<uint64_t>(lhs)) & mask};
+    return static_cast<T>((lowbits * static_cast<uint64_t>(D)) >> 48u);
+  }
+#if defined(__SIZEOF_INT128__)
+  else if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+    __extension__ using uint128_t = unsigned __int128;
+    constexpr auto m{
+      static_cast<uint64_t>(std::numeric_limits<uint64_t>::max() / D + 1u)};
+    auto const lowbits{m * static_cast<uint64_t>(lhs)};
+    return static_cast<T>((static_cast<uint128_t>(lowbits) *
+                           static_cast<uint128_t>(D)) >>
+                          64u);
+  }
+#endif
+  else return static_cast<T>(lhs % static_cast<T>(D));
 }
 
 /// Digit
@@ -161,4 +306,351 @@ constexpr auto hundreds_digit(T value) {
   return digit<100>(value);
 }
 
+/// Floating point types with constexpr approximations of transcendental
+/// functions
+template<typename T>
+concept approximable_floating_point =
+  std::same_as<T, float> || std::same_as<T, double>;
+
+namespace detail {
+
+/// Evaluate polynomial with coefficients in ascending order
+///
+/// \tparam T     Type of value
+/// \tparam N     Number of coefficients
+/// \param  x     Value
+/// \param  coeffs Coefficients
+/// \return c0 + c1*x + c2*x^2 + ...
+template<std::floating_point T, size_t N>
+constexpr T horner(T x, std::array<double, N> const& coeffs) {
+  T retval{};
+  for (auto i{N}; i-- > 0uz;) retval = retval * x + static_cast<T>(coeffs[i]);
+  return retval;
+}
+
+/// Round to nearest integer (half away from zero)
+///
+/// \tparam T     Type of value
+/// \param  value Value
+/// \return Rounded value
+template<std::floating_point T>
+constexpr int64_t round_to_int(T value) {
+  return static_cast<int64_t>(value + (value < 0 ? T{-0.5} : T{0.5}));
+}
+
+/// Split a constant into high and low parts (Cody-Waite), so that k * hi is
+/// exact for small k
+///
+/// \tparam T   Type of constant
+/// \param  hi  High part as double
+/// \param  lo  Low part as double
+/// \return Pair of high and low part
+template<approximable_floating_point T>
+constexpr std::pair<T, T> split_constant(double hi, double lo) {
+  if constexpr (std::same_as<T, double>) return {hi, lo};
+  else {
+    auto const h{std::bit_cast<float>(
+      std::bit_cast<uint32_t>(static_cast<float>(hi)) & 0xFFFF'F000u)};
+    return {h, static_cast<float>((hi - static_cast<double>(h)) + lo)};
+  }
+}
+
+/// 2^n
+///
+/// \tparam T Type of value
+/// \param  n Exponent
+/// \return 2^n
+template<approximable_floating_point T>
+constexpr T exp2_int(int64_t n) {
+  using U = std::conditional_t<std::same_as<T, double>, uint64_t, uint32_t>;
+  constexpr auto digits{std::numeric_limits<T>::digits - 1};
+  constexpr auto bias{std::numeric_limits<T>::max_exponent - 1};
+  assert(n >= 1 - bias && n <= bias);
+  return std::bit_cast<T>(static_cast<U>(static_cast<U>(n + bias) << digits));
+}
+
+/// Sign bit, also set for -0 and negative NaN
+///
+/// \tparam T Type of value
+/// \param  x Value
+/// \return true if sign bit of x is set
+template<approximable_floating_point T>
+constexpr bool signbit(T x) {
+  using U = std::conditional_t<std::same_as<T, double>, uint64_t, uint32_t>;
+  return std::bit_cast<U>(x) >> (std::numeric_limits<U>::digits - 1);
+}
+
+inline constexpr auto pio2_hi{1.57079632673412561417e+00};
+inline constexpr auto pio2_lo{6.07710050650619224932e-11};
+inline constexpr auto pi{3.14159265358979311600e+00};
+inline constexpr auto ln2_hi{6.93147180369123816490e-01};
+inline constexpr auto ln2_lo{1.90821492927058770002e-10};
+
+/// Sine on [-pi/4, pi/4]
+template<approximable_floating_point T>
+constexpr T sin_kernel(T x) {
+  auto const z{x * x};
+  if constexpr (std::same_as<T, float>)
+    return x * horner(z,
+                      std::array{1.0,
+                                 -1.0 / 6.0,
+                                 1.0 / 120.0,
+                                 -1.0 / 5040.0,
+                                 1.0 / 362880.0});
+  else
+    return x * horner(z,
+                      std::array{1.0,
+                                 -1.0 / 6.0,
+                                 1.0 / 120.0,
+                                 -1.0 / 5040.0,
+                                 1.0 / 362880.0,
+                                 -1.0 / 39916800.0,
+                                 1.0 / 6227020800.0,
+                                 -1.0 / 1307674368000.0});
+}
+
+/// Cosine on [-pi/4, pi/4]
+template<approximable_floating_point T>
+constexpr T cos_kernel(T x) {
+  auto const z{x * x};
+  if constexpr (std::same_as<T, float>)
+    return horner(z,
+                  std::array{1.0,
+                             -1.0 / 2.0,
+                             1.0 / 24.0,
+                             -1.0 / 720.0,
+                             1.0 / 40320.0,
+                             -1.0 / 3628800.0});
+  else
+    return horner(z,
+                  std::array{1.0,
+                             -1.0 / 2.0,
+                             1.0 / 24.0,
+                             -1.0 / 720.0,
+                             1.0 / 40320.0,
+                             -1.0 / 3628800.0,
+                             1.0 / 479001600.0,
+                             -1.0 / 87178291200.0,
+                             1.0 / 20922789888000.0});
+}
+
+/// Bound of |x| up to which rem_pio2 is accurate, k * pi/2 is only exact for
+/// small k because the high part of pi/2 has 33 (double) or 12 (float)
+/// significant bits
+template<approximable_floating_point T>
+inline constexpr T rem_pio2_max{std::same_as<T, double> ? 0x1p20 : 0x1p12};
+
+/// Reduce x to r in [-pi/4, pi/4] so that x = r + k * pi/2
+///
+/// \tparam T Type of value
+/// \param  x Value (|x| < rem_pio2_max)
+/// \return Pair of quadrant (k mod 4) and r
+template<approximable_floating_point T>
+constexpr std::pair<int64_t, T> rem_pio2(T x) {
+  assert(x > -rem_pio2_max<T> && x < rem_pio2_max<T>);
+  constexpr auto pio2{split_constant<T>(pio2_hi, pio2_lo)};
+  auto const k{round_to_int(x * static_cast<T>(2.0 / pi))};
+  auto const kt{static_cast<T>(k)};
+  return {k & 3, (x - kt * pio2.first) - kt * pio2.second};
+}
+
+} // namespace detail
+
+/// Sine
+///
+/// The argument reduction is accurate for |x| < 2^20 with double and for
+/// |x| < 2^12 with float, whose high part of pi/2 only has 12 significant bits.
+/// Larger arguments, infinity and NaN return NaN.
+///
+/// \tparam T Type of value
+/// \param  x Angle in radians
+/// \return sin(x)
+template<approximable_floating_point T>
+constexpr T sin(T x) {
+  if (!(x > -detail::rem_pio2_max<T> && x < detail::rem_pio2_max<T>))
+    return std::numeric_limits<T>::quiet_NaN();
+  auto const [k, r]{detail::rem_pio2(x)};
+  switch (k) {
+    case 0: return detail::sin_kernel(r);
+    case 1: return detail::cos_kernel(r);
+    case 2: return -detail::sin_kernel(r);
+    default: return -detail::cos_kernel(r);
+  }
+}
+
+/// Cosine
+///
+/// The argument reduction is accurate for |x| < 2^20 with double and for
+/// |x| < 2^12 with float, whose high part of pi/2 only has 12 significant bits.
+/// Larger arguments, infinity and NaN return NaN.
+///
+/// \tparam T Type of value
+/// \param  x Angle in radians
+/// \return cos(x)
+template<approximable_floating_point T>
+constexpr T cos(T x) {
+  if (!(x > -detail::rem_pio2_max<T> && x < detail::rem_pio2_max<T>))
+    return std::numeric_limits<T>::quiet_NaN();
+  auto const [k, r]{detail::rem_pio2(x)};
+  switch (k) {
+    case 0: return detail::cos_kernel(r);
+    case 1: return -detail::sin_kernel(r);
+    case 2: return -detail::cos_kernel(r);
+    default: return detail::sin_kernel(r);
+  }
+}
+
+/// Exponential function
+///
+/// \tparam T Type of value
+/// \param  x Value
+/// \return e^x
+template<approximable_floating_point T>
+constexpr T exp(T x) {
+  constexpr auto ln2{detail::split_constant<T>(detail::ln2_hi, detail::ln2_lo)};
+  constexpr auto max_exponent{std::numeric_limits<T>::max_exponent};
+  constexpr auto min_exponent{std::numeric_limits<T>::min_exponent -
+                              std::numeric_limits<T>::digits};
+  if (x != x) return x;
+  else if (x > static_cast<T>(max_exponent * (detail::ln2_hi + detail::ln2_lo)))
+    return std::numeric_limits<T>::infinity();
+  else if (x < static_cast<T>(min_exponent * (detail::ln2_hi + detail::ln2_lo)))
+    return 0;
+  auto const k{detail::round_to_int(x / static_cast<T>(detail::ln2_hi))};
+  auto const kt{static_cast<T>(k)};
+  auto const r{(x - kt * ln2.first) - kt * ln2.second};
+  T p{};
+  if constexpr (std::same_as<T, float>)
+    p = detail::horner(r,
+                       std::array{1.0,
+                                  1.0,
+                                  1.0 / 2.0,
+                                  1.0 / 6.0,
+                                  1.0 / 24.0,
+                                  1.0 / 120.0,
+                                  1.0 / 720.0,
+                                  1.0 / 5040.0});
+  else
+    p = detail::horner(r,
+                       std::array{1.0,
+                                  1.0,
+                                  1.0 / 2.0,
+                                  1.0 / 6.0,
+                                  1.0 / 24.0,
+                                  1.0 / 120.0,
+                                  1.0 / 720.0,
+                                  1.0 / 5040.0,
+                                  1.0 / 40320.0,
+                                  1.0 / 362880.0,
+                                  1.0 / 3628800.0,
+                                  1.0 / 39916800.0,
+                                  1.0 / 479001600.0});
+  // Scale in two steps so that subnormal results and 2^max_exponent work
+  auto const k1{k / 2};
+  return p * detail::exp2_int<T>(k1) * detail::exp2_int<T>(k - k1);
+}
+
+/// Square root
+///
+/// \tparam T Type of value
+/// \param  x Value
+/// \return sqrt(x)
+template<approximable_floating_point T>
+constexpr T sqrt(T x) {
+  using U = std::conditional_t<std::same_as<T, double>, uint64_t, uint32_t>;
+  constexpr auto digits{std::numeric_limits<T>::digits};
+  if (x != x || x < 0) return std::numeric_limits<T>::quiet_NaN();
+  else if (x == 0 || x == std::numeric_limits<T>::infinity()) return x;
+  // Scale subnormals into the normal range
+  else if (x < std::numeric_limits<T>::min())
+    return sqrt(x * detail::exp2_int<T>(2 * digits)) /
+           detail::exp2_int<T>(digits);
+  // Halving the exponent bits yields a first guess within ~6%
+  constexpr auto magic{std::bit_cast<U>(T{1}) >> 1u};
+  auto y{std::bit_cast<T>(static_cast<U>(magic + (std::bit_cast<U>(x) >> 1u)))};
+  for (auto i{0}; i < (std::same_as<T, float> ? 3 : 4); ++i)
+    y = static_cast<T>(0.5) * (y + x / y);
+  return y;
+}
+
+/// Arc tangent
+///
+/// Reduction and minimax coefficients taken from fdlibm's s_atan.c.
+///
+/// \tparam T Type of value
+/// \param  x Value
+/// \return atan(x)
+template<approximable_floating_point T>
+constexpr T atan(T x) {
+  constexpr std::array atanhi{4.63647609000806093515e-01,
+                              7.85398163397448278999e-01,
+                              9.82793723247329054082e-01,
+                              1.57079632679489655800e+00};
+  constexpr std::array atanlo{2.26987774529616870924e-17,
+                              3.06161699786838301793e-17,
+                              1.39033110312309984516e-17,
+                              6.12323399573676603587e-17};
+  constexpr std::array odd{3.33333333333329318027e-01,
+                           1.42857142725034663711e-01,
+                           9.09088713343650656196e-02,
+                           6.66107313738753120669e-02,
+                           4.97687799461593236017e-02,
+                           1.62858201153657823623e-02};
+  constexpr std::array even{-1.99999999998764832476e-01,
+                            -1.11111104054623557880e-01,
+                            -7.69187620504482999495e-02,
+                            -5.83357013379057348645e-02,
+                            -3.65315727442169155270e-02};
+  if (x != x) return x;
+  auto const negative{detail::signbit(x)};
+  auto a{negative ? -x : x};
+  int id{-1};
+  if (a >= static_cast<T>(7.0 / 16.0)) {
+    if (a < static_cast<T>(11.0 / 16.0)) {
+      id = 0;
+      a = (2 * a - 1) / (2 + a);
+    } else if (a < static_cast<T>(19.0 / 16.0)) {
+      id = 1;
+      a = (a - 1) / (a + 1);
+    } else if (a < static_cast<T>(39.0 / 16.0)) {
+      id = 2;
+      a = (a - static_cast<T>(1.5)) / (1 + static_cast<T>(1.5) * a);
+    } else {
+      id = 3;
+      a = -1 / a;
+    }
+  }
+  auto const z{a * a};
+  auto const w{z * z};
+  auto const s{z * detail::horner(w, odd) + w * detail::horner(w, even)};
+  if (id < 0) return negative ? -(a - a * s) : a - a * s;
+  auto const i{static_cast<size_t>(id)};
+  auto const retval{static_cast<T>(atanhi[i]) -
+                    ((a * s - static_cast<T>(atanlo[i])) - a)};
+  return negative ? -retval : retval;
+}
+
+/// Arc tangent of y/x using the signs of both arguments to determine the
+/// quadrant
+///
+/// \tparam T Type of values
+/// \param  y Y
+/// \param  x X
+/// \return atan2(y, x)
+template<approximable_floating_point T>
+constexpr T atan2(T y, T x) {
+  constexpr auto pi{static_cast<T>(detail::pi)};
+  // Results take the sign of y, including -0 and -inf
+  auto const sign{[y](T value) { return detail::signbit(y) ? -value : value; }};
+  if (x != x || y != y) return std::numeric_limits<T>::quiet_NaN();
+  else if (y - y != y - y) {
+    if (x - x == x - x) return sign(pi / 2);
+    else if (x > 0) return sign(pi / 4);
+    else return sign(static_cast<T>(3.0 * detail::pi / 4.0));
+  } else if (x > 0) return atan(y / x);
+  else if (x < 0) return sign(pi) + atan(y / x);
+  else if (y != 0) return sign(pi / 2);
+  else return sign(detail::signbit(x) ? pi : T{});
+}
+
 } // namespace ztl
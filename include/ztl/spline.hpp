@@ -12,6 +12,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
 #include "math.hpp"
 
 namespace ztl {
@@ -28,63 +32,153 @@ struct spline {
   T a1{};
 };
 
-/// Make splines
+namespace detail {
+
+/// Slope at an interior point
+///
+/// \tparam std::floating_point Type
+/// \param  h0                  Left interval width
+/// \param  h1                  Right interval width
+/// \param  del0                Left secant slope
+/// \param  del1                Right secant slope
+/// \return Slope
+template<std::floating_point T>
+constexpr T interior_slope(T h0, T h1, T del0, T del1) {
+  if ((sign(del1) * sign(del0)) <= 0) return 0;
+  auto const hs{h1 + h0};
+  auto const dmax{std::max(std::abs(del0), std::abs(del1))};
+  auto const dmin{std::min(std::abs(del0), std::abs(del1))};
+  return dmin / (((h0 + hs) / (3u * hs)) * (del0 / dmax) +
+                 ((hs + h1) / (3u * hs)) * (del1 / dmax));
+}
+
+/// Slope at an end point
+///
+/// \tparam std::floating_point Type
+/// \param  h0                  Outer interval width
+/// \param  h1                  Inner interval width
+/// \param  del0                Outer secant slope
+/// \param  del1                Inner secant slope
+/// \return Slope
+template<std::floating_point T>
+constexpr T end_slope(T h0, T h1, T del0, T del1) {
+  auto const s{((2u * h0 + h1) * del0 - h0 * del1) / (h0 + h1)};
+  if (sign(s) != sign(del0)) return 0;
+  else if ((sign(del0) != sign(del1)) && (std::abs(s) > std::abs(3u * del0)))
+    return 3u * del0;
+  else return s;
+}
+
+/// Spline coefficients of a single interval
+///
+/// \tparam std::floating_point Type
+/// \param  h                   Interval width
+/// \param  del                 Secant slope
+/// \param  s0                  Slope at left point
+/// \param  s1                  Slope at right point
+/// \return Spline
+template<std::floating_point T>
+constexpr spline<T> hermite_spline(T h, T del, T s0, T s1) {
+  auto const dzzdx{(del - s0) / h};
+  auto const dzdxdx{(s1 - del) / h};
+  return {.a3 = (dzdxdx - dzzdx) / h, .a2 = 2u * dzzdx - dzdxdx, .a1 = s0};
+}
+
+} // namespace detail
+
+/// Hermite splines which keep their intermediate results around so that
+/// single knots can be changed without recalculating every spline
 ///
 /// \tparam std::floating_point Type
 /// \tparam I                   Size of x and y
-/// \param  x                   Input x
-/// \param  y                   Input y
-/// \return Array of splines
 template<std::floating_point T, size_t I>
 requires(I >= 3uz)
-constexpr std::array<spline<T>, I - 1uz>
-make_hermite_splines(std::array<T, I> const& x, std::array<T, I> const& y) {
-  std::array<spline<T>, I - 1uz> splines{};
-  std::array<T, I - 1uz> h{};
-  std::array<T, I> del{};
-  std::array<T, I> s{};
+struct hermite_splines {
+  /// Ctor
+  ///
+  /// \param  x Input x
+  /// \param  y Input y
+  constexpr hermite_splines(std::array<T, I> const& x,
+                            std::array<T, I> const& y)
+    : _x{x}, _y{y} {
+    for (auto i{0uz}; i < I - 1uz; ++i) {
+      _h[i] = _x[i + 1uz] - _x[i];
+      _del[i] = (_y[i + 1uz] - _y[i]) / _h[i];
+    }
+    slopes(1uz, I - 2uz);
+    coefficients(0uz, I - 2uz);
+  }
 
-  for (auto i{0uz}; i < I - 1u; ++i) {
-    h[i] = x[i + 1uz] - x[i];
-    del[i] = (y[i + 1uz] - y[i]) / h[i];
+  /// Change y of a single knot
+  ///
+  /// Only the secant slopes left and right of the knot change. Those affect at
+  /// most three interior slopes, the end slopes if they are close enough and
+  /// the coefficients of the intervals adjacent to any changed slope.
+  ///
+  /// \param  i Index of knot
+  /// \param  y New y
+  constexpr void update_knot(size_t i, T y) {
+    assert(i < I);
+    _y[i] = y;
+    if (i) _del[i - 1uz] = (_y[i] - _y[i - 1uz]) / _h[i - 1uz];
+    if (i < I - 1uz) _del[i] = (_y[i + 1uz] - _y[i]) / _h[i];
+    auto const first{i > 1uz ? i - 1uz : 1uz};
+    auto const last{std::min(i + 1uz, I - 2uz)};
+    slopes(first, last);
+    coefficients(first - 1uz, last);
   }
 
-  // Find slopes at interior points
-  for (auto i{0uz}; i < I - 1u; ++i) {
-    if ((sign(del[i + 1uz]) * sign(del[i])) <= 0) continue;
-    auto const hs{h[i + 1uz] + h[i]};
-    auto const dmax{std::max(std::abs(del[i]), std::abs(del[i + 1uz]))};
-    auto const dmin{std::min(std::abs(del[i]), std::abs(del[i + 1uz]))};
-    s[i + 1uz] =
-      dmin / (((h[i] + hs) / (3u * hs)) * (del[i] / dmax) +
-              ((hs + h[i + 1uz]) / (3u * hs)) * (del[i + 1uz] / dmax));
+  constexpr std::array<T, I> const& x() const { return _x; }
+  constexpr std::array<T, I> const& y() const { return _y; }
+  constexpr std::array<spline<T>, I - 1uz> const& splines() const {
+    return _splines;
   }
 
-  // Find slopes at end points
-  s[0uz] =
-    ((2u * h[0uz] + h[1uz]) * del[0uz] - h[0uz] * del[1uz]) / (h[0uz] + h[1uz]);
-  if (sign(s[0uz]) != sign(del[0uz])) s[0uz] = 0;
-  else if ((sign(del[0uz]) != sign(del[1uz])) &&
-           (std::abs(s[0uz]) > std::abs(3u * del[0uz])))
-    s[0uz] = 3u * del[0uz];
-
-  s[I - 1uz] = ((2u * h[I - 2uz] + h[I - 3uz]) * del[I - 2uz] -
-                h[I - 2uz] * del[I - 3uz]) /
-               (h[I - 2uz] + h[I - 3uz]);
-  if (sign(s[I - 1uz]) != sign(del[I - 2uz])) s[I - 1uz] = 0;
-  else if ((sign(del[I - 2uz]) != sign(del[I - 3uz])) &&
-           (std::abs(s[I - 1uz]) > std::abs(3u * del[I - 2uz])))
-    s[I - 1uz] = 3u * del[I - 2uz];
+private:
+  /// Find slopes at interior points [first, last] and end points if affected
+  ///
+  /// \param  first  First interior point
+  /// \param  last   Last interior point
+  constexpr void slopes(size_t first, size_t last) {
+    for (auto i{first}; i <= last; ++i)
+      _s[i] =
+        detail::interior_slope(_h[i - 1uz], _h[i], _del[i - 1uz], _del[i]);
+    if (first <= 1uz)
+      _s[0uz] = detail::end_slope(_h[0uz], _h[1uz], _del[0uz], _del[1uz]);
+    if (last >= I - 2uz)
+      _s[I - 1uz] = detail::end_slope(
+        _h[I - 2uz], _h[I - 3uz], _del[I - 2uz], _del[I - 3uz]);
+  }
 
-  for (auto i{0uz}; i < I - 1u; ++i) {
-    auto const dzzdx{(del[i] - s[i]) / h[i]};
-    auto const dzdxdx{(s[i + 1uz] - del[i]) / h[i]};
-    splines[i].a1 = s[i];
-    splines[i].a2 = 2u * dzzdx - dzdxdx;
-    splines[i].a3 = (dzdxdx - dzzdx) / h[i];
+  /// Calculate coefficients of intervals [first, last]
+  ///
+  /// \param  first  First interval
+  /// \param  last   Last interval
+  constexpr void coefficients(size_t first, size_t last) {
+    for (auto i{first}; i <= last; ++i)
+      _splines[i] = detail::hermite_spline(_h[i], _del[i], _s[i], _s[i + 1uz]);
   }
 
-  return splines;
+  std::array<T, I> _x{};
+  std::array<T, I> _y{};
+  std::array<T, I - 1uz> _h{};
+  std::array<T, I - 1uz> _del{};
+  std::array<T, I> _s{};
+  std::array<spline<T>, I - 1uz> _splines{};
+};
+
+/// Make splines
+///
+/// \tparam std::floating_point Type
+/// \tparam I                   Size of x and y
+/// \param  x                   Input x
+/// \param  y                   Input y
+/// \return Array of splines
+template<std::floating_point T, size_t I>
+requires(I >= 3uz)
+constexpr std::array<spline<T>, I - 1uz>
+make_hermite_splines(std::array<T, I> const& x, std::array<T, I> const& y) {
+  return hermite_splines<T, I>{x, y}.splines();
 }
 
 /// Evaluate splines
@@ -0,0 +1,238 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Static map
+///
+/// \file   ztl/static_map.hpp
+/// \author Vincent Hamp
+/// \date   19/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include "fixed_string.hpp"
+#include "limits.hpp"
+
+namespace ztl {
+
+/// Key value pair of a static_map
+///
+/// \tparam I Key length
+/// \tparam V Type of value
+template<size_t I, typename V>
+struct key_value {
+  fixed_string<I> key;
+  V value;
+};
+
+template<size_t I, typename V>
+key_value(fixed_string<I>, V) -> key_value<I, V>;
+
+namespace detail {
+
+/// 32 bit integer finalizer (lowbias32)
+///
+/// \param  h Hash
+/// \return Mixed hash
+constexpr uint32_t mix32(uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x7FEB'352Du;
+  h ^= h >> 15;
+  h *= 0x846C'A68Bu;
+  h ^= h >> 16;
+  return h;
+}
+
+/// Seeded FNV-1a hash with finalizer
+///
+/// \param  str   String
+/// \param  seed  Seed
+/// \return Hash
+constexpr uint32_t static_map_hash(std::string_view str, uint32_t seed) {
+  return mix32(fnv1a(str, seed));
+}
+
+/// Slot of hash h with displacement d
+///
+/// \param  h Hash
+/// \param  d Displacement
+/// \return Unmasked slot
+constexpr uint32_t static_map_slot(uint32_t h, uint32_t d) {
+  return mix32(h + d * 0x9E37'79B9u);
+}
+
+/// Perfect hash function
+///
+/// \tparam N Number of keys
+template<size_t N>
+struct perfect_hash {
+  static constexpr auto slots_count{std::bit_ceil(N)};
+  uint32_t seed{};
+  std::array<uint32_t, slots_count> displacements{};
+  std::array<size_t, slots_count> slots{};
+};
+
+/// Not constexpr, calling it during constant evaluation fails compilation
+inline void perfect_hash_not_found() {}
+
+/// Create perfect hash function (hash and displace)
+///
+/// Keys are hashed once and distributed into buckets by the lower bits of their
+/// hash. Starting with the largest bucket, each bucket searches for a
+/// displacement which moves all of its keys to free slots. Should two keys
+/// share the same 32 bit hash another seed is tried.
+///
+/// \tparam N     Number of keys
+/// \param  keys  Keys
+/// \return Perfect hash function
+template<size_t N>
+consteval perfect_hash<N>
+make_perfect_hash(std::array<std::string_view, N> const& keys) {
+  using ph = perfect_hash<N>;
+  constexpr auto mask{static_cast<uint32_t>(ph::slots_count - 1uz)};
+  for (uint32_t seed{}; seed < 256u; ++seed) {
+    ph retval{.seed = seed};
+    std::array<uint32_t, N> hashes{};
+    for (auto i{0uz}; i < N; ++i) hashes[i] = static_map_hash(keys[i], seed);
+    auto sorted{hashes};
+    std::ranges::sort(sorted);
+    if (std::ranges::adjacent_find(sorted) != end(sorted)) continue;
+
+    // Sort keys by bucket (counting sort)
+    std::array<size_t, ph::slots_count + 1uz> firsts{};
+    for (auto h : hashes) ++firsts[(h & mask) + 1uz];
+    for (auto b{0uz}; b < ph::slots_count; ++b) firsts[b + 1uz] += firsts[b];
+    std::array<size_t, N> members{};
+    auto nexts{firsts};
+    for (auto i{0uz}; i < N; ++i) members[nexts[hashes[i] & mask]++] = i;
+
+    retval.slots.fill(N);
+    auto success{true};
+    auto max_count{0uz};
+    for (auto b{0uz}; b < ph::slots_count; ++b)
+      max_count = std::max(max_count, firsts[b + 1uz] - firsts[b]);
+    for (auto count{max_count}; count && success; --count)
+      for (auto b{0uz}; b < ph::slots_count && success; ++b) {
+        if (firsts[b + 1uz] - firsts[b] != count) continue;
+        success = false;
+        for (uint32_t d{}; d < 0x1'0000u && !success; ++d) {
+          // Tentatively place keys of bucket, roll back on collision
+          auto m{firsts[b]};
+          for (; m < firsts[b + 1uz]; ++m) {
+            auto const i{members[m]};
+            auto& slot{retval.slots[static_map_slot(hashes[i], d) & mask]};
+            if (slot != N) break;
+            slot = i;
+          }
+          success = m == firsts[b + 1uz];
+          if (success) retval.displacements[b] = d;
+          else
+            while (m-- > firsts[b])
+              retval.slots[static_map_slot(hashes[members[m]], d) & mask] = N;
+        }
+      }
+    if (success) return retval;
+  }
+  perfect_hash_not_found();
+  return {};
+}
+
+} // namespace detail
+
+/// Map with compile-time fixed_string keys
+///
+/// Lookups of runtime strings hash the string once with a perfect hash
+/// function created at compile time and compare against a single candidate
+/// key.
+///
+/// \tparam KVs...  Key value pairs
+template<auto... KVs>
+requires(sizeof...(KVs) > 0uz)
+struct static_map {
+  using key_type = std::string_view;
+  using mapped_type = std::remove_cvref_t<decltype((KVs.value, ...))>;
+
+  static_assert((std::same_as<decltype(KVs.value), mapped_type> && ...),
+                "Values must have the same type");
+
+  static constexpr auto npos{std::string_view::npos};
+
+  /// Keys in order of declaration
+  static constexpr std::array<std::string_view, sizeof...(KVs)> keys{
+    std::string_view{KVs.key}...};
+
+  /// Values in order of declaration
+  static constexpr std::array<mapped_type, sizeof...(KVs)> values{
+    KVs.value...};
+
+  static_assert(
+    [] {
+      auto sorted{keys};
+      std::ranges::sort(sorted);
+      return std::ranges::adjacent_find(sorted) == end(sorted);
+    }(),
+    "Keys must be unique");
+
+  static constexpr size_t size() { return sizeof...(KVs); }
+
+  /// Find index of key
+  ///
+  /// \param  key Key
+  /// \return Index of key in order of declaration or npos
+  static constexpr size_t index_of(std::string_view key) {
+    auto const h{detail::static_map_hash(key, ph.seed)};
+    auto const i{
+      slots[detail::static_map_slot(h, displacements[h & mask]) & mask]};
+    return i < size() && keys[i] == key ? i : npos;
+  }
+
+  /// Find value of key
+  ///
+  /// \param  key Key
+  /// \return Pointer to value or nullptr
+  static constexpr mapped_type const* find(std::string_view key) {
+    auto const i{index_of(key)};
+    return i != npos ? &values[i] : nullptr;
+  }
+
+  /// Check whether map contains key
+  ///
+  /// \param  key Key
+  /// \return true if map contains key
+  static constexpr bool contains(std::string_view key) {
+    return index_of(key) != npos;
+  }
+
+private:
+  static constexpr auto ph{detail::make_perfect_hash(keys)};
+  static constexpr auto mask{static_cast<uint32_t>(ph.slots_count - 1uz)};
+
+  /// Displacements packed into the smallest possible type
+  static constexpr auto displacements{[] {
+    std::array<smallest_unsigned_t<*std::ranges::max_element(
+                 ph.displacements)>,
+               ph.slots_count>
+      retval{};
+    std::ranges::copy(ph.displacements, retval.begin());
+    return retval;
+  }()};
+
+  /// Slots packed into the smallest possible type
+  static constexpr auto slots{[] {
+    std::array<smallest_unsigned_t<sizeof...(KVs)>, ph.slots_count> retval{};
+    std::ranges::transform(ph.slots, retval.begin(), [](size_t i) {
+      return static_cast<smallest_unsigned_t<sizeof...(KVs)>>(i);
+    });
+    return retval;
+  }()};
+};
+
+} // namespace ztl
@@ -11,12 +11,146 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "fixed_string.hpp"
+#include "limits.hpp"
 #include "utility.hpp"
 
 namespace ztl {
 
+namespace detail {
+
+inline constexpr auto word_ones{~size_t{} / 0xFFu};
+inline constexpr auto word_low7{word_ones * 0x7Fu};
+
+/// Mark zero bytes of word
+///
+/// \param  word Word
+/// \return Word with MSB set in every byte which is zero
+constexpr size_t zero_bytes(size_t word) {
+  return ~(((word & word_low7) + word_low7) | word | word_low7);
+}
+
+/// Index of first marked byte in memory order
+///
+/// \param  marks Word returned by zero_bytes
+/// \return Byte index
+constexpr size_t first_byte(size_t marks) {
+  if constexpr (std::endian::native == std::endian::little)
+    return static_cast<size_t>(std::countr_zero(marks)) / 8uz;
+  else return static_cast<size_t>(std::countl_zero(marks)) / 8uz;
+}
+
+#if defined(__GNUC__)
+// The word-at-a-time functions below load whole aligned words through a
+// may_alias type. Aligned loads never cross a page boundary, but they read past
+// the null terminator on purpose, which is why they are excluded from address
+// sanitizing. Other compilers use the plain byte-wise loops.
+
+/// Word type which may alias char
+using alias_word_t [[gnu::may_alias]] = size_t;
+
+/// Check whether pointer is word aligned
+///
+/// \param  ptr  Pointer
+/// \return true if ptr is word aligned
+inline bool word_aligned(char const* ptr) {
+  return !(reinterpret_cast<uintptr_t>(ptr) % sizeof(size_t));
+}
+
+/// Word-at-a-time strlen
+///
+/// \param  str Pointer to the null-terminated byte string
+/// \return Length of str
+[[gnu::no_sanitize_address]] inline size_t strlen_words(char const* str) {
+  auto ptr{str};
+  for (; !word_aligned(ptr); ++ptr)
+    if (!*ptr) return static_cast<size_t>(ptr - str);
+  for (;; ptr += sizeof(size_t))
+    if (auto const marks{
+          zero_bytes(*reinterpret_cast<alias_word_t const*>(ptr))})
+      return static_cast<size_t>(ptr - str) + first_byte(marks);
+}
+
+/// Word-at-a-time strchr
+///
+/// \param  str Pointer to the null-terminated byte string
+/// \param  ch  Character to search for
+/// \return Pointer to found character or nullptr
+[[gnu::no_sanitize_address]] inline char const* strchr_words(char const* str,
+                                                             char ch) {
+  for (; !word_aligned(str); ++str)
+    if (*str == ch) return str;
+    else if (!*str) return nullptr;
+  auto const pattern{word_ones * static_cast<uint8_t>(ch)};
+  for (;; str += sizeof(size_t)) {
+    auto const word{*reinterpret_cast<alias_word_t const*>(str)};
+    if (auto const marks{zero_bytes(word) | zero_bytes(word ^ pattern)}) {
+      str += first_byte(marks);
+      return *str == ch ? str : nullptr;
+    }
+  }
+}
+
+/// Word-at-a-time strcmp
+///
+/// Compares whole words while both strings share the same alignment and
+/// finishes byte-wise on the first word containing a difference or a null
+/// terminator.
+///
+/// \param  lhs Pointer to the null-terminated byte string
+/// \param  rhs Pointer to the null-terminated byte string
+/// \return Pointers to the first characters which need to be compared
+[[gnu::no_sanitize_address]] inline std::pair<char const*, char const*>
+strcmp_words(char const* lhs, char const* rhs) {
+  if (reinterpret_cast<uintptr_t>(lhs) % sizeof(size_t) !=
+      reinterpret_cast<uintptr_t>(rhs) % sizeof(size_t))
+    return {lhs, rhs};
+  for (; !word_aligned(lhs); ++lhs, ++rhs)
+    if (!*lhs || *lhs != *rhs) return {lhs, rhs};
+  for (;; lhs += sizeof(size_t), rhs += sizeof(size_t)) {
+    auto const l{*reinterpret_cast<alias_word_t const*>(lhs)};
+    auto const r{*reinterpret_cast<alias_word_t const*>(rhs)};
+    if (l != r || zero_bytes(l)) return {lhs, rhs};
+  }
+}
+
+/// Word-at-a-time search for the null terminator
+///
+/// \param  str   Pointer to the null-terminated byte string
+/// \param  count Minimum number of characters to check
+/// \return Pair of number of characters without terminator (at least count if
+///         no terminator was found) and whether the terminator was found
+[[gnu::no_sanitize_address]] inline std::pair<size_t, bool>
+find_terminator_words(char const* str, size_t count) {
+  auto ptr{str};
+  for (; !word_aligned(ptr); ++ptr)
+    if (!*ptr) return {static_cast<size_t>(ptr - str), true};
+  for (;; ptr += sizeof(size_t)) {
+    if (static_cast<size_t>(ptr - str) >= count)
+      return {static_cast<size_t>(ptr - str), false};
+    if (auto const marks{
+          zero_bytes(*reinterpret_cast<alias_word_t const*>(ptr))})
+      return {static_cast<size_t>(ptr - str) + first_byte(marks), true};
+  }
+}
+#endif
+
+} // namespace detail
+
 /// Interprets an integer value in a byte string pointed to by str
 ///
 /// \param  str Pointer to the null-terminated byte string to be interpreted
@@ -86,6 +220,11 @@ constexpr char* strncpy(char* dest, char const* src, size_t count) {
 /// \param  str Pointer to the null-terminated byte strings to compare
 /// \return Length of the C string str
 constexpr size_t strlen(char const* str) {
+#if defined(__GNUC__)
+  if !consteval {
+    return detail::strlen_words(str);
+  }
+#endif
   size_t retval{};
   while (str[retval]) ++retval;
   return retval;
@@ -100,16 +239,19 @@ constexpr size_t strlen(char const* str) {
 /// \return 0   Zero if lhs and rhs compare equal.
 /// \return >0  Positive value if lhs appears after rhs in lexicographical
 ///             order.
+///
+/// \note Comparison stops at the end of the shorter string.
 constexpr int32_t strcmp(char const* lhs, char const* rhs) {
-  size_t min{std::min(strlen(lhs), strlen(rhs))};
-  size_t retval{};
-  for (; retval < min; ++retval) {
-    if (!lhs[retval] || !rhs[retval]) break;
-    if (lhs[retval] != rhs[retval])
-      return static_cast<uint8_t>(lhs[retval]) -
-             static_cast<uint8_t>(rhs[retval]);
+#if defined(__GNUC__)
+  if !consteval {
+    std::tie(lhs, rhs) = detail::strcmp_words(lhs, rhs);
+  }
+#endif
+  for (;; ++lhs, ++rhs) {
+    if (!*lhs || !*rhs) return 0;
+    if (*lhs != *rhs)
+      return static_cast<uint8_t>(*lhs) - static_cast<uint8_t>(*rhs);
   }
-  return 0;
 }
 
 /// Finds the first occurrence of the character ch in the byte string pointed to
@@ -120,35 +262,436 @@ constexpr int32_t strcmp(char const* lhs, char const* rhs) {
 /// \return Pointer to the found character in str, or a null pointer if no such
 ///         character is found.
 constexpr char const* strchr(char const* str, int ch) {
-  while (*str != ch)
+#if defined(__GNUC__)
+  if !consteval {
+    return detail::strchr_words(str, static_cast<char>(ch));
+  }
+#endif
+  while (*str != static_cast<char>(ch))
     if (!*str++) return nullptr;
   return str;
 }
 
+namespace detail {
+
+/// Create Boyer-Moore-Horspool bad character table
+///
+/// Shifts are saturated at the maximum of T, which only makes them shorter and
+/// therefore keeps the search correct.
+///
+/// \tparam T      Type of shifts
+/// \param  needle Pointer to needle
+/// \param  m      Length of needle
+/// \return Bad character table
+template<std::unsigned_integral T>
+constexpr std::array<T, 256uz> make_horspool_table(char const* needle,
+                                                   size_t m) {
+  constexpr auto max{static_cast<size_t>(std::numeric_limits<T>::max())};
+  std::array<T, 256uz> retval{};
+  retval.fill(static_cast<T>(std::min(m, max)));
+  for (auto i{0uz}; i < m - 1uz; ++i)
+    retval[static_cast<uint8_t>(needle[i])] =
+      static_cast<T>(std::min(m - 1uz - i, max));
+  return retval;
+}
+
+/// Boyer-Moore-Horspool search
+///
+/// \tparam T        Type of shifts
+/// \param  haystack Pointer to haystack
+/// \param  n        Length of haystack
+/// \param  needle   Pointer to needle
+/// \param  m        Length of needle (>0)
+/// \param  table    Bad character table
+/// \return Pointer to first occurrence of needle in haystack or nullptr
+template<std::unsigned_integral T>
+constexpr char const* horspool_search(char const* haystack,
+                                      size_t n,
+                                      char const* needle,
+                                      size_t m,
+                                      std::array<T, 256uz> const& table) {
+  if (n < m) return nullptr;
+  auto const last{needle[m - 1uz]};
+  for (auto i{0uz}; i <= n - m;) {
+    auto const c{haystack[i + m - 1uz]};
+    if (c == last && std::equal(needle, needle + m - 1uz, haystack + i))
+      return haystack + i;
+    i += table[static_cast<uint8_t>(c)];
+  }
+  return nullptr;
+}
+
+/// Needles shorter than this are searched without a bad character table
+inline constexpr auto horspool_min_needle{8uz};
+
+/// Naive search for short needles
+///
+/// Candidates are found with strchr, so the haystack is only read up to the
+/// match or the null terminator.
+///
+/// \param  haystack Pointer to null-terminated haystack
+/// \param  needle   Pointer to null-terminated needle (not empty)
+/// \return Pointer to first occurrence of needle in haystack or nullptr
+constexpr char const* naive_search(char const* haystack, char const* needle) {
+  for (;; ++haystack) {
+    if (!(haystack = strchr(haystack, *needle))) return nullptr;
+    auto a{haystack + 1};
+    auto b{needle + 1};
+    for (; *b && *a == *b; ++a, ++b);
+    if (!*b) return haystack;
+    if (!*a) return nullptr;
+  }
+}
+
+/// Search for the null terminator
+///
+/// \param  str   Pointer to the null-terminated byte string
+/// \param  count Minimum number of characters to check
+/// \return Pair of number of characters without terminator (at least count if
+///         no terminator was found) and whether the terminator was found
+constexpr std::pair<size_t, bool> find_terminator(char const* str,
+                                                  size_t count) {
+#if defined(__GNUC__)
+  if !consteval {
+    return find_terminator_words(str, count);
+  }
+#endif
+  for (auto i{0uz}; i < count; ++i)
+    if (!str[i]) return {i, true};
+  return {count, false};
+}
+
+/// Boyer-Moore-Horspool search in null-terminated haystack
+///
+/// Instead of taking the length of the haystack first, the characters up to the
+/// end of the current window are checked for the null terminator as the window
+/// advances. The search stops at the terminator.
+///
+/// \param  haystack Pointer to null-terminated haystack
+/// \param  needle   Pointer to needle
+/// \param  m        Length of needle (>0)
+/// \return Pointer to first occurrence of needle in haystack or nullptr
+constexpr char const*
+horspool_search(char const* haystack, char const* needle, size_t m) {
+  auto const table{make_horspool_table<uint8_t>(needle, m)};
+  auto const last{needle[m - 1uz]};
+  auto known{0uz}; // [haystack, haystack + known) contains no terminator
+  auto end{false};  // haystack[known] is the terminator
+  for (auto i{0uz};; i += table[static_cast<uint8_t>(haystack[i + m - 1uz])]) {
+    if (known < i + m && !end) {
+      auto const [count, found]{
+        find_terminator(haystack + known, i + m - known)};
+      known += count;
+      end = found;
+    }
+    if (known < i + m) return nullptr;
+    if (haystack[i + m - 1uz] == last &&
+        std::equal(needle, needle + m - 1uz, haystack + i))
+      return haystack + i;
+  }
+}
+
+} // namespace detail
+
 /// Finds the first occurrence of the byte string needle in the byte string
 /// pointed to by haystack.
 ///
+/// Short needles use a naive search, longer ones Boyer-Moore-Horspool with a
+/// bad character table of 256 bytes.
+///
 /// \param  haystack
 /// \param  needle
 /// \return Pointer to the first character of the found substring in haystack,
 ///         or a null pointer if no such character is found. If needle points to
 ///         an empty string, haystack is returned.
 constexpr char const* strstr(char const* haystack, char const* needle) {
-  char const* a{haystack};
-  char const* b{needle};
-  for (;;)
-    if (!*b) return haystack;
-    else if (!*a) return nullptr;
-    else if (*a++ != *b++) {
-      a = ++haystack;
-      b = needle;
+  if (!*needle) return haystack;
+  for (auto i{1uz}; i < detail::horspool_min_needle; ++i)
+    if (!needle[i]) return detail::naive_search(haystack, needle);
+  return detail::horspool_search(haystack, needle, strlen(needle));
+}
+
+/// Boyer-Moore-Horspool searcher with precompiled needle
+///
+/// The bad character table is created at compile time so repeated searches for
+/// the same needle skip preprocessing.
+///
+/// \tparam Needle Needle
+template<fixed_string Needle>
+struct searcher {
+  static constexpr auto needle{Needle};
+  static constexpr auto size{Needle.size()};
+  static_assert(size > 0uz, "Needle must not be empty");
+
+  /// Bad character table
+  static constexpr auto table{
+    detail::make_horspool_table<smallest_unsigned_t<size>>(needle.c_str(),
+                                                           size)};
+
+  /// Search needle in range
+  ///
+  /// \param  first  Pointer to first character of haystack
+  /// \param  last   Pointer to one past last character of haystack
+  /// \return Pointer to first occurrence of needle or nullptr
+  constexpr char const* operator()(char const* first, char const* last) const {
+    return detail::horspool_search(first,
+                                   static_cast<size_t>(last - first),
+                                   needle.c_str(),
+                                   size,
+                                   table);
+  }
+
+  /// Search needle in null-terminated byte string
+  ///
+  /// \param  haystack Pointer to null-terminated byte string
+  /// \return Pointer to first occurrence of needle or nullptr
+  constexpr char const* operator()(char const* haystack) const {
+    return (*this)(haystack, haystack + strlen(haystack));
+  }
+};
+
+namespace detail {
+
+/// Digit characters for bases up to 36
+inline constexpr char digit_chars[]{"0123456789abcdefghijklmnopqrstuvwxyz"};
+
+/// Lookup table of all two digit decimal numbers "00" to "99"
+inline constexpr auto digit_pairs{[] {
+  std::array<char, 200uz> retval{};
+  for (auto i{0uz}; i < 100uz; ++i) {
+    retval[2uz * i] = static_cast<char>('0' + i / 10uz);
+    retval[2uz * i + 1uz] = static_cast<char>('0' + i % 10uz);
+  }
+  return retval;
+}()};
+
+/// Value of digit character
+///
+/// \param  c  Character
+/// \return Value of c or a value >=36 if c isn't a digit
+constexpr uint32_t digit_value(char c) {
+  auto const u{static_cast<uint32_t>(static_cast<uint8_t>(c))};
+  if (u - '0' < 10u) return u - '0';
+  if ((u | 0x20u) - 'a' < 26u) return (u | 0x20u) - 'a' + 10u;
+  return std::numeric_limits<uint32_t>::max();
+}
+
+/// Count digits of value in base
+///
+/// \tparam T     Type of value
+/// \param  value Value
+/// \param  base  Base
+/// \return Number of digits
+template<std::unsigned_integral T>
+constexpr ptrdiff_t count_digits(T value, T base) {
+  auto const width{static_cast<ptrdiff_t>(std::bit_width(value))};
+  if (base == 2u) return std::max(width, ptrdiff_t{1});
+  if (base == 16u) return std::max((width + 3) / 4, ptrdiff_t{1});
+  ptrdiff_t retval{1};
+  if (base == 10u)
+    for (; value >= 10000u; value /= 10000u) retval += 4;
+  for (; value >= base; value /= base) ++retval;
+  return retval;
+}
+
+/// Write digits of value in base backwards ending at last
+///
+/// \tparam T     Type of value
+/// \param  last  Pointer to one past last digit
+/// \param  value Value
+/// \param  base  Base
+template<std::unsigned_integral T>
+constexpr void write_digits(char* last, T value, T base) {
+  switch (base) {
+    case 2u:
+      do *--last = static_cast<char>('0' + (value & 1u));
+      while (value >>= 1u);
+      break;
+    case 16u:
+      do *--last = digit_chars[value & 0xFu];
+      while (value >>= 4u);
+      break;
+    case 10u:
+      for (; value >= 100u; value /= 100u) {
+        auto const i{value % 100u * 2u};
+        *--last = digit_pairs[i + 1u];
+        *--last = digit_pairs[i];
+      }
+      if (value >= 10u) {
+        *--last = digit_pairs[value * 2u + 1u];
+        *--last = digit_pairs[value * 2u];
+      } else *--last = static_cast<char>('0' + value);
+      break;
+    default:
+      do *--last = digit_chars[value % base];
+      while (value /= base);
+      break;
+  }
+}
+
+} // namespace detail
+
+/// Parse integer
+///
+/// Behaves like std::from_chars. An optional minus sign is accepted for signed
+/// types, no leading whitespace, plus sign or base prefix.
+///
+/// \tparam T     Type of value
+/// \param  first Pointer to first character
+/// \param  last  Pointer to one past last character
+/// \param  value Parsed value, only modified on success
+/// \param  base  Base (2 to 36)
+/// \return Pointer to first character not matching the pattern and error code
+///         (std::errc::invalid_argument if there are no digits,
+///         std::errc::result_out_of_range on overflow)
+template<std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr std::from_chars_result
+from_chars(char const* first, char const* last, T& value, int base = 10) {
+  assert(2 <= base && base <= 36);
+  using M = std::make_unsigned_t<T>;
+  using U = std::common_type_t<M, uint32_t>;
+  auto ptr{first};
+  bool negative{};
+  if constexpr (std::signed_integral<T>)
+    if (ptr != last && *ptr == '-') {
+      negative = true;
+      ++ptr;
     }
+  auto const limit{
+    static_cast<U>(static_cast<U>(std::numeric_limits<T>::max()) + negative)};
+  auto const b{static_cast<U>(base)};
+  auto const cutoff{limit / b};
+  auto const cutlim{limit % b};
+  auto const digits_first{ptr};
+  U acc{};
+  bool overflow{};
+  for (; ptr != last; ++ptr) {
+    auto const d{static_cast<U>(detail::digit_value(*ptr))};
+    if (d >= b) break;
+    if (acc > cutoff || (acc == cutoff && d > cutlim)) overflow = true;
+    else acc = acc * b + d;
+  }
+  if (ptr == digits_first) return {first, std::errc::invalid_argument};
+  if (overflow) return {ptr, std::errc::result_out_of_range};
+  value = static_cast<T>(negative ? static_cast<M>(M{} - static_cast<M>(acc))
+                                  : static_cast<M>(acc));
+  return {ptr, std::errc{}};
+}
+
+/// Format integer
+///
+/// Behaves like std::to_chars. Decimal digits are written two at a time from a
+/// lookup table, base 2 and 16 use shifts instead of divisions.
+///
+/// \tparam T     Type of value
+/// \param  first Pointer to first character of output buffer
+/// \param  last  Pointer to one past last character of output buffer
+/// \param  value Value
+/// \param  base  Base (2 to 36)
+/// \return Pointer to one past last written character and error code
+///         (std::errc::value_too_large if the buffer is too small)
+template<std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr std::to_chars_result
+to_chars(char* first, char* last, T value, int base = 10) {
+  assert(2 <= base && base <= 36);
+  using M = std::make_unsigned_t<T>;
+  using U = std::common_type_t<M, uint32_t>;
+  auto u{static_cast<U>(static_cast<M>(value))};
+  if constexpr (std::signed_integral<T>)
+    if (value < 0) {
+      if (first == last) return {last, std::errc::value_too_large};
+      *first++ = '-';
+      u = static_cast<U>(static_cast<M>(M{} - static_cast<M>(value)));
+    }
+  auto const b{static_cast<U>(base)};
+  auto const n{detail::count_digits(u, b)};
+  if (last - first < n) return {last, std::errc::value_too_large};
+  detail::write_digits(first + n, u, b);
+  return {first + n, std::errc{}};
+}
+
+namespace detail {
+
+/// Lookup table of binary digits of all nibbles
+inline constexpr auto binary_nibbles{[] {
+  std::array<std::array<char, 4uz>, 16uz> retval{};
+  for (auto i{0uz}; i < size(retval); ++i)
+    for (auto j{0uz}; j < 4uz; ++j)
+      retval[i][j] = i >> (3uz - j) & 1uz ? '1' : '0';
+  return retval;
+}()};
+
+/// Number of characters to_binary_chars writes
+///
+/// \tparam T         Type of value
+/// \param  separator Separator between nibbles or '\0' for none
+/// \return Number of characters
+template<std::integral T>
+constexpr size_t binary_chars_size(char separator) {
+  constexpr auto digits{
+    static_cast<size_t>(std::numeric_limits<std::make_unsigned_t<T>>::digits)};
+  return 2uz + digits + (separator ? digits / 4uz - 1uz : 0uz);
+}
+
+} // namespace detail
+
+/// Format integer as binary
+///
+/// Writes "0b" followed by all digits of value (including leading zeros), with
+/// an optional separator between nibbles (e.g. 0b0001'1010). Unlike the
+/// INTxx_TO_BINARY macros this does not depend on printf.
+///
+/// \tparam T         Type of value
+/// \param  value     Value
+/// \param  out       Output buffer
+/// \param  separator Separator between nibbles or '\0' for none
+/// \return Pointer to one past last written character and error code
+///         (std::errc::value_too_large if the buffer is too small)
+template<std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr std::to_chars_result
+to_binary_chars(T value, std::span<char> out, char separator = '\'') {
+  using U = std::make_unsigned_t<T>;
+  if (size(out) < detail::binary_chars_size<T>(separator))
+    return {data(out) + size(out), std::errc::value_too_large};
+  auto ptr{data(out)};
+  *ptr++ = '0';
+  *ptr++ = 'b';
+  auto const u{static_cast<U>(value)};
+  for (auto i{std::numeric_limits<U>::digits}; i > 0;) {
+    i -= 4;
+    auto const& nibble{
+      detail::binary_nibbles[static_cast<size_t>(u >> i & 0xF)]};
+    ptr = std::copy(cbegin(nibble), cend(nibble), ptr);
+    if (separator && i) *ptr++ = separator;
+  }
+  return {ptr, std::errc{}};
+}
+
+/// Format integer as binary fixed_string
+///
+/// \tparam Separator Separator between nibbles or '\0' for none
+/// \tparam T         Type of value
+/// \param  value     Value
+/// \return fixed_string containing binary representation of value
+template<char Separator = '\'', std::integral T>
+requires(!std::same_as<T, bool>)
+constexpr auto to_binary_chars(T value) {
+  fixed_string<detail::binary_chars_size<T>(Separator)> retval{};
+  to_binary_chars(value, retval._str, Separator);
+  return retval;
 }
 
 /// Printf format to print int8 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define INT8_TO_BINARY_FORMAT "0b%c%c%c%c'%c%c%c%c"
 
 /// Convert int8 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define INT8_TO_BINARY(int8)                                                   \
   (int8 & 0x80 ? '1' : '0'), (int8 & 0x40 ? '1' : '0'),                        \
     (int8 & 0x20 ? '1' : '0'), (int8 & 0x10 ? '1' : '0'),                      \
@@ -156,21 +699,33 @@ constexpr char const* strstr(char const* haystack, char const* needle) {
     (int8 & 0x02 ? '1' : '0'), (int8 & 0x01 ? '1' : '0')
 
 /// Printf format to print uint8 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT8_TO_BINARY_FORMAT INT8_TO_BINARY_FORMAT
 
 /// Convert uint8 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT8_TO_BINARY INT8_TO_BINARY
 
 /// Printf format to print char as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define CHAR_TO_BINARY_FORMAT INT8_TO_BINARY_FORMAT
 
 /// Convert char to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define CHAR_TO_BINARY INT8_TO_BINARY
 
 /// Printf format to print int16 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define INT16_TO_BINARY_FORMAT "0b%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c"
 
 /// Convert int16 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define INT16_TO_BINARY(int16)                                                 \
   (int16 & 0x00008000 ? '1' : '0'), (int16 & 0x00004000 ? '1' : '0'),          \
     (int16 & 0x00002000 ? '1' : '0'), (int16 & 0x00001000 ? '1' : '0'),        \
@@ -182,16 +737,24 @@ constexpr char const* strstr(char const* haystack, char const* needle) {
     (int16 & 0x00000002 ? '1' : '0'), (int16 & 0x00000001 ? '1' : '0')
 
 /// Printf format to print uint16 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT16_TO_BINARY_FORMAT INT16_TO_BINARY_FORMAT
 
 /// Convert uint16 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT16_TO_BINARY INT16_TO_BINARY
 
 /// Printf format to print int32 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define INT32_TO_BINARY_FORMAT                                                 \
   "0b%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c"
 
 /// Convert int32 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define INT32_TO_BINARY(int32)                                                 \
   (int32 & 0x80000000 ? '1' : '0'), (int32 & 0x40000000 ? '1' : '0'),          \
     (int32 & 0x20000000 ? '1' : '0'), (int32 & 0x10000000 ? '1' : '0'),        \
@@ -211,36 +774,56 @@ constexpr char const* strstr(char const* haystack, char const* needle) {
     (int32 & 0x00000002 ? '1' : '0'), (int32 & 0x00000001 ? '1' : '0')
 
 /// Printf format to print uint32 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT32_TO_BINARY_FORMAT INT32_TO_BINARY_FORMAT
 
 /// Convert uint32 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT32_TO_BINARY INT32_TO_BINARY
 
 /// Printf format to print sizet as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define SIZET_TO_BINARY_FORMAT INT32_TO_BINARY_FORMAT
 
 /// Convert sizet to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define SIZET_TO_BINARY INT32_TO_BINARY
 
 /// Printf format to print ptrdiff as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define PTRDIFF_TO_BINARY_FORMAT INT32_TO_BINARY_FORMAT
 
 /// Convert ptrdiff to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define PTRDIFF_TO_BINARY INT32_TO_BINARY
 
 /// Printf format to print int64 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define INT64_TO_BINARY_FORMAT                                                 \
   "0b%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'" \
   "%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c'%c%c%c%c"
 
 /// Convert int64 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define INT64_TO_BINARY(int64)                                                 \
   INT32_TO_BINARY(int64 >> 32), INT32_TO_BINARY(int64)
 
 /// Printf format to print uint64 as binary
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT64_TO_BINARY_FORMAT INT64_TO_BINARY_FORMAT
 
 /// Convert uint64 to chars
+///
+/// \deprecated Use to_binary_chars instead
 #define UINT64_TO_BINARY INT64_TO_BINARY
 
 } // namespace ztl
@@ -10,18 +10,25 @@
 
 #pragma once
 
+#include "bitfield.hpp"
 #include "bits.hpp"
 #include "compilation_time.hpp"
 #include "counted_latch.hpp"
+#include "crc.hpp"
 #include "delayed_latch.hpp"
 #include "directional_latch.hpp"
 #include "edge_detector.hpp"
 #include "enum.hpp"
 #include "explicit_wrapper.hpp"
 #include "fail.hpp"
+#include "fixed_point.hpp"
 #include "fixed_string.hpp"
+#include "format.hpp"
+#include "hysteresis_latch.hpp"
 #include "implicit_wrapper.hpp"
+#include "inplace_bitset.hpp"
 #include "inplace_deque.hpp"
+#include "inplace_string.hpp"
 #include "inplace_vector.hpp"
 #include "limits.hpp"
 #include "math.hpp"
@@ -30,6 +37,7 @@
 #include "overload.hpp"
 #include "spline.hpp"
 #include "static_list.hpp"
+#include "static_map.hpp"
 #include "string.hpp"
 #include "system_error.hpp"
 #include "type_traits.hpp"
@@ -0,0 +1,56 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <ztl/bitfield.hpp>
+
+namespace {
+
+using ctrl = ztl::reg<uint32_t, struct ctrl_tag>;
+using enable = ztl::field<ctrl, ztl::mask<0u>>;
+using mode = ztl::field<ctrl, ztl::mask<4u, 5u, 6u>>;
+using prescaler = ztl::field<ctrl, ztl::mask<8u, 9u, 12u, 13u>>;
+
+using status = ztl::reg<uint8_t, struct status_tag>;
+using ready = ztl::field<status, ztl::mask<7u>>;
+
+} // namespace
+
+TEST(bitfield, field) {
+  EXPECT_EQ(enable{1u}.bits(), 0x1u);
+  EXPECT_EQ(mode{0b101u}.bits(), 0b101'0000u);
+  EXPECT_EQ(prescaler{0b1011u}.bits(), 0b10'0011'0000'0000u);
+  EXPECT_EQ(prescaler::get(0b10'0011'0000'0000u), 0b1011u);
+  EXPECT_TRUE((std::same_as<ready::value_type, uint8_t>));
+  EXPECT_EQ(ready{1u}.bits(), 0x80u);
+}
+
+TEST(bitfield, read) {
+  uint32_t volatile word{0b11'0011'0101'0001u};
+  ctrl r{word};
+  EXPECT_EQ(r.read(), 0b11'0011'0101'0001u);
+  EXPECT_EQ(r.read<enable>(), 1u);
+  EXPECT_EQ(r.read<mode>(), 0b101u);
+  EXPECT_EQ(r.read<prescaler>(), 0b1111u);
+}
+
+TEST(bitfield, write) {
+  uint32_t volatile word{0xFFFF'FFFFu};
+  ctrl r{word};
+  r.write(enable{1u}, mode{0b011u});
+  EXPECT_EQ(word, 0b011'0001u);
+  r.write(0x42u);
+  EXPECT_EQ(word, 0x42u);
+}
+
+TEST(bitfield, modify) {
+  uint32_t volatile word{0xFFFF'0000u};
+  ctrl r{word};
+  r.modify(enable{1u}, mode{0b010u}, prescaler{0b0110u});
+  EXPECT_EQ(word, 0xFFFF'0000u | 0b01'0010'0010'0001u);
+  r.modify(mode{0u});
+  EXPECT_EQ(word, 0xFFFF'0000u | 0b01'0010'0000'0001u);
+
+  uint8_t volatile byte{0x0Fu};
+  status s{byte};
+  s.modify(ready{1u});
+  EXPECT_EQ(byte, 0x8Fu);
+}
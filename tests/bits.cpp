@@ -1,5 +1,6 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <vector>
 #include <ztl/bits.hpp>
 
 TEST(bits, mask) {
@@ -70,3 +71,133 @@ TEST(bits, runs_count) {
   EXPECT_EQ(ztl::runs_count(0b101001u), 3uz);
   EXPECT_EQ(ztl::runs_count(0b001011001111u), 3uz);
 }
+
+namespace {
+
+template<auto Mask>
+void expect_runtime_mask_equal() {
+  for (auto value : {0x0ull,
+                     0x1ull,
+                     0x5ull,
+                     0xA5ull,
+                     0x1234ull,
+                     0xDEAD'BEEFull,
+                     0xFFFF'FFFF'FFFF'FFFFull}) {
+    EXPECT_EQ(ztl::map_value_to(Mask, value), ztl::map_value_to<Mask>(value));
+    EXPECT_EQ(ztl::map_value_from(Mask, value),
+              ztl::map_value_from<Mask>(value));
+  }
+}
+
+} // namespace
+
+TEST(bits, map_to_runtime_mask) {
+  auto value{0b0101u};
+  EXPECT_EQ(ztl::map_value_to(0b1101u, value), 0b1001u);
+  static_assert(ztl::map_value_to(0b1101u, 0b0101u) == 0b1001u);
+  static_assert(ztl::map_value_to(0xFFu, 0x1234u) == 0x34u);
+  static_assert(ztl::map_value_to(~0ull, ~0ull) == ~0ull);
+}
+
+TEST(bits, map_from_runtime_mask) {
+  auto field{0b1001u};
+  EXPECT_EQ(ztl::map_value_from(0b1101u, field), 0b0101u);
+  static_assert(ztl::map_value_from(0b1101u, 0b1001u) == 0b0101u);
+  static_assert(ztl::map_value_from(0xF0u, 0x1234u) == 0x3u);
+  static_assert(ztl::map_value_from(~0ull, ~0ull) == ~0ull);
+}
+
+TEST(bits, runtime_mask_equals_compile_time_mask) {
+  expect_runtime_mask_equal<static_cast<uint8_t>(0b1000'0001u)>();
+  expect_runtime_mask_equal<static_cast<uint8_t>(0xFFu)>();
+  expect_runtime_mask_equal<static_cast<uint16_t>(0b1011'0110'0111'1001u)>();
+  expect_runtime_mask_equal<0x8000'0001u>();
+  expect_runtime_mask_equal<0xF0F0'0FF0u>();
+  expect_runtime_mask_equal<0xFFFF'FFFFu>();
+  expect_runtime_mask_equal<0x8000'0000'0000'0001ull>();
+  expect_runtime_mask_equal<0xFF00'F0F0'0000'FF01ull>();
+}
+
+TEST(bits, bit_mapper) {
+  constexpr ztl::bit_mapper mapper{0b1101u};
+  static_assert(mapper.to(0b0101u) == 0b1001u);
+  static_assert(mapper.from(0b1001u) == 0b0101u);
+  static_assert(mapper.runs_count() == 2uz);
+  EXPECT_EQ(mapper.mask(), 0b1101u);
+
+  for (auto mask : {0x0u, 0x1u, 0x8000'0001u, 0xF0F0'0FF0u, 0xAAAA'AAAAu}) {
+    ztl::bit_mapper const m{mask};
+    EXPECT_EQ(m.runs_count(), static_cast<size_t>(ztl::runs_count(mask)));
+    for (auto value : {0x0u, 0x5u, 0x1234u, 0xDEAD'BEEFu}) {
+      EXPECT_EQ(m.to(value), ztl::map_value_to(mask, value));
+      EXPECT_EQ(m.from(value), ztl::map_value_from(mask, value));
+    }
+  }
+
+  ztl::bit_mapper const m64{0xFFFF'FFFF'FFFF'FFFFull};
+  EXPECT_EQ(m64.to(0x1234ull), 0x1234ull);
+  EXPECT_EQ(m64.from(0x1234ull), 0x1234ull);
+
+  ztl::bit_mapper const m8{static_cast<uint8_t>(0b1010'0111u)};
+  EXPECT_EQ(m8.to(0b1'1111u), 0b1010'0111u);
+  EXPECT_EQ(m8.from(static_cast<uint8_t>(0b1000'0101u)), 0b1'0101u);
+}
+
+TEST(bits, reverse_bits) {
+  EXPECT_EQ(ztl::reverse_bits(uint8_t{0b1000'0110u}), 0b0110'0001u);
+  EXPECT_EQ(ztl::reverse_bits(uint16_t{0x0001u}), 0x8000u);
+  EXPECT_EQ(ztl::reverse_bits(0x1234'5678u), 0x1E6A'2C48u);
+  EXPECT_EQ(ztl::reverse_bits(0x0000'0000'0000'00F1ull),
+            0x8F00'0000'0000'0000ull);
+  static_assert(ztl::reverse_bits(uint8_t{1u}) == 0x80u);
+}
+
+TEST(bits, reverse_bits_lut_equals_reverse_bits) {
+  for (auto i{0u}; i < 0x1'0000u; i += 7u) {
+    EXPECT_EQ(ztl::reverse_bits_lut(static_cast<uint16_t>(i)),
+              ztl::reverse_bits(static_cast<uint16_t>(i)));
+    EXPECT_EQ(ztl::reverse_bits_lut(i * 0x9E37'79B9u),
+              ztl::reverse_bits(i * 0x9E37'79B9u));
+    EXPECT_EQ(ztl::reverse_bits_lut(i * 0x9E37'79B9'7F4A'7C15ull),
+              ztl::reverse_bits(i * 0x9E37'79B9'7F4A'7C15ull));
+  }
+}
+
+TEST(bits, to_from_endian) {
+  EXPECT_EQ(ztl::to_endian<std::endian::native>(0x1234u), 0x1234u);
+  if constexpr (std::endian::native == std::endian::little) {
+    EXPECT_EQ(ztl::to_endian<std::endian::big>(uint16_t{0x1234u}), 0x3412u);
+    EXPECT_EQ(ztl::from_endian<std::endian::big>(0x7856'3412u), 0x1234'5678u);
+  }
+}
+
+TEST(bits, interleave_bits) {
+  EXPECT_EQ(ztl::interleave_bits(uint8_t{0b1111u}, uint8_t{0b0000u}),
+            0b0101'0101u);
+  EXPECT_EQ(ztl::interleave_bits(uint8_t{0u}, uint8_t{0xFFu}), 0xAAAAu);
+  EXPECT_TRUE((std::same_as<decltype(ztl::interleave_bits(0u, 0u)), uint64_t>));
+  EXPECT_EQ(ztl::interleave_bits(0xFFFF'FFFFu, 0u), 0x5555'5555'5555'5555ull);
+
+  for (auto i{0u}; i < 0x1'0000u; i += 13u) {
+    auto const x{i * 0x9E37'79B9u};
+    auto const y{~i * 0x85EB'CA6Bu};
+    EXPECT_EQ(ztl::interleave_bits_lut(x, y), ztl::interleave_bits(x, y));
+    auto const [a, b]{ztl::deinterleave_bits(ztl::interleave_bits(x, y))};
+    EXPECT_EQ(a, x);
+    EXPECT_EQ(b, y);
+  }
+}
+
+TEST(bits, set_bits) {
+  std::vector<size_t> v;
+  for (auto i : ztl::set_bits(0b1010'0110u)) v.push_back(i);
+  EXPECT_EQ(v, (std::vector{1uz, 2uz, 5uz, 7uz}));
+
+  EXPECT_EQ(std::ranges::distance(ztl::set_bits(uint8_t{})), 0);
+  EXPECT_EQ(*ztl::set_bits(uint64_t{1ull << 63}).begin(), 63uz);
+  static_assert(std::ranges::distance(ztl::set_bits(0xFFFF'FFFFu)) == 32);
+  using iterator = ztl::set_bits_view<uint32_t>::iterator;
+  EXPECT_TRUE(std::forward_iterator<iterator>);
+  EXPECT_TRUE((std::same_as<std::iterator_traits<iterator>::iterator_category,
+                            std::input_iterator_tag>));
+}
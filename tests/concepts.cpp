@@ -15,3 +15,11 @@ TEST(concepts, chrono_duration) {
   EXPECT_TRUE(ztl::chrono_duration<decltype(s)>);
   EXPECT_TRUE(ztl::chrono_duration<decltype(h)>);
 }
+
+// Check if type is chrono_clock
+TEST(concepts, chrono_clock) {
+  EXPECT_TRUE(ztl::chrono_clock<std::chrono::steady_clock>);
+  EXPECT_TRUE(ztl::chrono_clock<std::chrono::system_clock>);
+  EXPECT_FALSE(ztl::chrono_clock<std::chrono::milliseconds>);
+  EXPECT_FALSE(ztl::chrono_clock<int>);
+}
@@ -1,6 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <optional>
+#include <random>
 #include <ztl/counted_latch.hpp>
 
 namespace {
@@ -116,3 +117,58 @@ TEST(counted_latch, set) {
     EXPECT_EQ(cl.value(), std::optional<int>{});
   }
 }
+
+TEST(counted_latch_bank, set) {
+  ztl::counted_latch_bank<8uz, 3uz> clb;
+  EXPECT_TRUE(clb.set(0b0000'0011u).none());
+  EXPECT_TRUE(clb.set(0b0000'0011u).none());
+  EXPECT_EQ(clb.set(0b0000'0001u), 0b0000'0001u);
+  EXPECT_EQ(clb.value(), 0b0000'0001u);
+
+  // Bit 1 was interrupted, bit 0 stays latched
+  EXPECT_TRUE(clb.set(0b0000'0010u).none());
+  EXPECT_TRUE(clb.set(0b0000'0010u).none());
+  EXPECT_EQ(clb.set(0b0000'0010u), 0b0000'0011u);
+  EXPECT_EQ(clb.value(), 0b0000'0010u);
+
+  clb.reset(0b1000'0000u);
+  EXPECT_EQ(clb.value(), 0b1000'0000u);
+}
+
+TEST(counted_latch_bank, same_as_counted_latch) {
+  static constexpr auto N{100uz};
+  static constexpr auto I{5uz};
+  ztl::counted_latch_bank<N, I> clb;
+  std::array<ztl::counted_latch<bool, I>, N> cls{};
+  std::mt19937 gen{42u};
+  std::bernoulli_distribution dist{0.8};
+  ztl::inplace_bitset<N> value;
+  for (auto i{0uz}; i < 1000uz; ++i) {
+    // Each input keeps its value with a probability of 80%
+    for (auto j{0uz}; j < N; ++j) value.set(j, value[j] == dist(gen));
+    auto const changed{clb.set(value)};
+    for (auto j{0uz}; j < N; ++j) {
+      auto const before{cls[j].value()};
+      cls[j].set(value[j]);
+      ASSERT_EQ(clb.value()[j], cls[j].value());
+      ASSERT_EQ(changed[j], before != cls[j].value());
+    }
+  }
+}
+
+TEST(counted_latch, set_returns_change) {
+  ztl::counted_latch<E, 2uz> cl;
+  EXPECT_FALSE(cl.set(E::_1));
+  EXPECT_TRUE(cl.set(E::_1));
+  EXPECT_FALSE(cl.set(E::_1));
+
+  // Latching the current value again isn't a change
+  EXPECT_FALSE(cl.set(E::_0));
+  EXPECT_FALSE(cl.set(E::_1));
+  EXPECT_FALSE(cl.set(E::_1));
+
+  // Counter doesn't overflow while the value stays latched
+  for (auto i{0uz}; i < 1000uz; ++i) EXPECT_FALSE(cl.set(E::_1));
+  EXPECT_FALSE(cl.set(E::_0));
+  EXPECT_TRUE(cl.set(E::_0));
+}
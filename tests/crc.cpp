@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <ztl/crc.hpp>
+
+namespace {
+
+constexpr std::array<uint8_t, 9uz> check{
+  '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+template<template<size_t> typename Crc>
+void expect_check(typename Crc<1uz>::value_type expected) {
+  EXPECT_EQ(Crc<1uz>::checksum(check), expected);
+  EXPECT_EQ(Crc<4uz>::checksum(check), expected);
+  EXPECT_EQ(Crc<8uz>::checksum(check), expected);
+}
+
+template<size_t Slices>
+using crc16_arc = ztl::crc<uint16_t{0x8005u},
+                           uint16_t{},
+                           true,
+                           true,
+                           uint16_t{},
+                           Slices>;
+
+template<size_t Slices>
+using crc32_mpeg2 = ztl::crc<uint32_t{0x04C1'1DB7u},
+                             uint32_t{0xFFFF'FFFFu},
+                             false,
+                             false,
+                             uint32_t{},
+                             Slices>;
+
+template<size_t Slices>
+using crc64_xz = ztl::crc<uint64_t{0x42F0'E1EB'A9EA'3693ull},
+                          ~uint64_t{},
+                          true,
+                          true,
+                          ~uint64_t{},
+                          Slices>;
+
+template<size_t Slices>
+using crc64_ecma = ztl::crc<uint64_t{0x42F0'E1EB'A9EA'3693ull},
+                            uint64_t{},
+                            false,
+                            false,
+                            uint64_t{},
+                            Slices>;
+
+} // namespace
+
+TEST(crc, known_answers) {
+  expect_check<ztl::crc8>(0xF4u);
+  expect_check<ztl::crc8_maxim>(0xA1u);
+  expect_check<ztl::crc16_ccitt>(0x29B1u);
+  expect_check<crc16_arc>(0xBB3Du);
+  expect_check<ztl::crc32>(0xCBF4'3926u);
+  expect_check<crc32_mpeg2>(0x0376'E6E7u);
+  expect_check<crc64_xz>(0x995D'C9BB'DF19'39FAull);
+  expect_check<crc64_ecma>(0x6C40'DF5F'0B49'7347ull);
+}
+
+TEST(crc, streaming) {
+  std::array<uint8_t, 1000uz> data{};
+  for (auto i{0uz}; i < size(data); ++i)
+    data[i] = static_cast<uint8_t>(i * 31uz + 7uz);
+
+  auto const expected{ztl::crc32<>::checksum(data)};
+  for (auto split : {0uz, 1uz, 3uz, 9uz, 500uz, 999uz}) {
+    ztl::crc32<8uz> c;
+    c.update(std::span{data}.first(split));
+    c.update(std::span{data}.subspan(split));
+    EXPECT_EQ(c.value(), expected);
+  }
+
+  ztl::crc16_ccitt<4uz> c;
+  for (auto b : data) c.update(b);
+  EXPECT_EQ(c.value(), ztl::crc16_ccitt<>::checksum(data));
+  c.reset();
+  EXPECT_EQ(c.update(check).value(), 0x29B1u);
+}
+
+TEST(crc, constexpr) {
+  static_assert(ztl::crc32<>::checksum(check) == 0xCBF4'3926u);
+  static_assert(ztl::crc8<4uz>::checksum(check) == 0xF4u);
+}
+
+TEST(crc, xor_checksum) {
+  EXPECT_EQ(ztl::xor_checksum({}), 0u);
+  std::array<uint8_t, 3uz> packet{0x03u, 0x3Fu, 0x8Au};
+  EXPECT_EQ(ztl::xor_checksum(packet), 0x03u ^ 0x3Fu ^ 0x8Au);
+}
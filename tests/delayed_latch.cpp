@@ -16,13 +16,24 @@ protected:
 
   template<typename Rep, typename Period>
   void SetFor(E e, std::chrono::duration<Rep, Period> duration) {
-    auto const then{std::chrono::system_clock::now() + duration};
-    while (std::chrono::system_clock::now() < then) _dl.set(e);
+    auto const then{std::chrono::steady_clock::now() + duration};
+    while (std::chrono::steady_clock::now() < then) _dl.set(e);
   }
 
   ztl::delayed_latch<E, std::chrono::milliseconds> _dl{E::_0, 100ms};
 };
 
+// Clock which only advances when told to
+struct manual_clock {
+  using rep = int64_t;
+  using period = std::milli;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<manual_clock>;
+  static constexpr bool is_steady{true};
+  static time_point now() { return _now; }
+  static inline time_point _now{};
+};
+
 } // namespace
 
 TEST_F(DelayedLatchTest, ctor) { EXPECT_EQ(_dl, E::_0); }
@@ -42,3 +53,41 @@ TEST_F(DelayedLatchTest, dont_set_long_enough_to_latch) {
   SetFor(E::_1, 50ms);
   EXPECT_EQ(_dl, E::_0);
 }
+
+TEST_F(DelayedLatchTest, set_with_time_point) {
+  auto const now{std::chrono::steady_clock::now()};
+  _dl.set(E::_1, now);
+  _dl.set(E::_1, now + 99ms);
+  EXPECT_EQ(_dl, E::_0);
+  _dl.set(E::_1, now + 100ms);
+  EXPECT_EQ(_dl, E::_1);
+  _dl.set(E::_0, now + 101ms);
+  _dl.set(E::_1, now + 150ms);
+  _dl.set(E::_0, now + 160ms);
+  _dl.set(E::_0, now + 259ms);
+  EXPECT_EQ(_dl, E::_1);
+  _dl.set(E::_0, now + 260ms);
+  EXPECT_EQ(_dl, E::_0);
+}
+
+TEST(delayed_latch, custom_clock) {
+  using namespace std::chrono_literals;
+  ztl::delayed_latch<int, std::chrono::milliseconds, manual_clock> dl{0, 10ms};
+  dl.set(1);
+  manual_clock::_now += 9ms;
+  dl.set(1);
+  EXPECT_EQ(dl, 0);
+  manual_clock::_now += 1ms;
+  dl.set(1);
+  EXPECT_EQ(dl, 1);
+}
+
+TEST_F(DelayedLatchTest, set_returns_change) {
+  auto const now{std::chrono::steady_clock::now()};
+  EXPECT_FALSE(_dl.set(E::_1, now));
+  EXPECT_FALSE(_dl.set(E::_1, now + 99ms));
+  EXPECT_TRUE(_dl.set(E::_1, now + 100ms));
+  EXPECT_FALSE(_dl.set(E::_1, now + 200ms));
+  EXPECT_FALSE(_dl.set(E::_0, now + 201ms));
+  EXPECT_TRUE(_dl.set(E::_0, now + 301ms));
+}
@@ -43,3 +43,13 @@ TEST(directional_latch, set) {
     EXPECT_EQ(dl, 42);
   }
 }
+
+TEST(directional_latch, set_returns_change) {
+  ztl::directional_latch<int, 2uz> dl{42};
+  EXPECT_FALSE(dl.set(43));
+  EXPECT_TRUE(dl.set(44));
+  EXPECT_EQ(dl, 44);
+  EXPECT_FALSE(dl.set(44));
+  EXPECT_FALSE(dl.set(40));
+  EXPECT_TRUE(dl.set(41));
+}
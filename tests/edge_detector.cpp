@@ -1,5 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <vector>
+#include <ztl/bits.hpp>
 #include <ztl/edge_detector.hpp>
 
 TEST(edge_detector, ctor) {
@@ -22,3 +24,38 @@ TEST(edge_detector, function_call) {
   EXPECT_EQ(ed(false), ztl::edge_detector::falling);
   EXPECT_EQ(ed(false), ztl::edge_detector::none);
 }
+
+TEST(edge_detector_bank, function_call) {
+  ztl::edge_detector_bank<70uz> edb{0b0110u};
+  auto const [rising, falling]{edb(0b1100u)};
+  EXPECT_EQ(rising, 0b1000u);
+  EXPECT_EQ(falling, 0b0010u);
+
+  ztl::inplace_bitset<70uz> value;
+  value.set(69uz);
+  auto const t{edb(value)};
+  EXPECT_EQ(std::vector(t.rising.begin(), t.rising.end()),
+            std::vector{69uz});
+  EXPECT_EQ(std::vector(t.falling.begin(), t.falling.end()),
+            (std::vector{2uz, 3uz}));
+
+  EXPECT_TRUE(edb(value).rising.none());
+}
+
+TEST(basic_edge_detector, function_call) {
+  ztl::basic_edge_detector<uint8_t> ed{0b0000'1111u};
+  auto const [rising, falling]{ed(0b0011'1100u)};
+  EXPECT_EQ(rising, 0b0011'0000u);
+  EXPECT_EQ(falling, 0b0000'0011u);
+
+  auto const t{ed(0b0011'1100u)};
+  EXPECT_EQ(t.rising, 0u);
+  EXPECT_EQ(t.falling, 0u);
+}
+
+TEST(basic_edge_detector, set_bits) {
+  ztl::basic_edge_detector<uint32_t> ed;
+  std::vector<size_t> pins;
+  for (auto pin : ztl::set_bits(ed(0x8000'0101u).rising)) pins.push_back(pin);
+  EXPECT_EQ(pins, (std::vector{0uz, 8uz, 31uz}));
+}
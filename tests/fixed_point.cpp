@@ -0,0 +1,228 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <ztl/fixed_point.hpp>
+
+using q7_8 = ztl::fixed<7uz, 8uz>;
+using q15_16 = ztl::fixed<15uz, 16uz>;
+
+TEST(fixed_point, value_type) {
+  EXPECT_TRUE((std::same_as<ztl::fixed<3uz, 4uz>::value_type, int8_t>));
+  EXPECT_TRUE((std::same_as<q7_8::value_type, int16_t>));
+  EXPECT_TRUE((std::same_as<q15_16::value_type, int32_t>));
+  EXPECT_TRUE((std::same_as<ztl::fixed<0uz, 31uz>::value_type, int32_t>));
+}
+
+TEST(fixed_point, ctor) {
+  constexpr q7_8 a{3};
+  EXPECT_EQ(a.raw(), 3 * 256);
+  constexpr q7_8 b{-1.5};
+  EXPECT_EQ(b.raw(), -384);
+  constexpr q7_8 c{0.1f};
+  EXPECT_EQ(c.raw(), 26);
+  EXPECT_EQ(q7_8::from_raw(42).raw(), 42);
+}
+
+TEST(fixed_point, ctor_saturates) {
+  EXPECT_EQ(q7_8{1000}, q7_8::max());
+  EXPECT_EQ(q7_8{-1000}, q7_8::min());
+  EXPECT_EQ(q7_8{128}, q7_8::max());
+  EXPECT_EQ(q7_8{-128}.raw(), -32768);
+  EXPECT_EQ(q7_8{1e9}, q7_8::max());
+  EXPECT_EQ(q7_8{-1e9}, q7_8::min());
+  EXPECT_EQ(q7_8{std::numeric_limits<uint64_t>::max()}, q7_8::max());
+}
+
+TEST(fixed_point, ctor_nan) {
+  EXPECT_EQ(q7_8{std::numeric_limits<double>::quiet_NaN()}, q7_8{});
+  EXPECT_EQ(q15_16{std::numeric_limits<float>::quiet_NaN()}, q15_16{});
+  EXPECT_FALSE((std::constructible_from<q7_8, bool>));
+  EXPECT_FALSE((std::constructible_from<q7_8, char>));
+  EXPECT_FALSE((std::constructible_from<q7_8, char8_t>));
+  EXPECT_TRUE((std::constructible_from<q7_8, signed char>));
+}
+
+TEST(fixed_point, conversions) {
+  constexpr q15_16 a{-2.75};
+  EXPECT_EQ(static_cast<int>(a), -2);
+  EXPECT_DOUBLE_EQ(static_cast<double>(a), -2.75);
+  EXPECT_FLOAT_EQ(static_cast<float>(q15_16{1234.5f}), 1234.5f);
+}
+
+TEST(fixed_point, add_sub) {
+  EXPECT_EQ(q7_8{1.25} + q7_8{2.5}, q7_8{3.75});
+  EXPECT_EQ(q7_8{1.25} - q7_8{2.5}, q7_8{-1.25});
+  EXPECT_EQ(q7_8{100} + q7_8{100}, q7_8::max());
+  EXPECT_EQ(q7_8{-100} - q7_8{100}, q7_8::min());
+  EXPECT_EQ(-q7_8::min(), q7_8::max());
+  EXPECT_EQ(-q15_16::min(), q15_16::max());
+  EXPECT_EQ((-ztl::fixed<0uz, 31uz>::min()), (ztl::fixed<0uz, 31uz>::max()));
+  static_assert(-q15_16::min() == q15_16::max());
+  q7_8 a{1};
+  a += q7_8{2};
+  a -= q7_8{0.5};
+  EXPECT_EQ(a, q7_8{2.5});
+}
+
+TEST(fixed_point, mul_div) {
+  EXPECT_EQ(q7_8{1.5} * q7_8{-2.25}, q7_8{-3.375});
+  EXPECT_EQ(q7_8{64} * q7_8{4}, q7_8::max());
+  EXPECT_EQ(q7_8{-64} * q7_8{4}, q7_8::min());
+  EXPECT_EQ(q7_8{7.5} / q7_8{2.5}, q7_8{3});
+  EXPECT_EQ(q7_8{-7.5} / q7_8{2.5}, q7_8{-3});
+  EXPECT_EQ(q7_8{100} / q7_8{0.25}, q7_8::max());
+  // Rounds to nearest
+  EXPECT_EQ((q7_8::from_raw(1) * q7_8{0.5}).raw(), 1);
+  EXPECT_EQ((q7_8{1} / q7_8{3}).raw(), 85);
+  EXPECT_EQ((q7_8{2} / q7_8{3}).raw(), 171);
+  EXPECT_EQ((q7_8{-2} / q7_8{3}).raw(), -171);
+  q15_16 a{3};
+  a *= q15_16{0.5};
+  a /= q15_16{0.25};
+  EXPECT_EQ(a, q15_16{6});
+}
+
+TEST(fixed_point, compare) {
+  EXPECT_LT(q7_8{-1}, q7_8{0.5});
+  EXPECT_GT(q7_8{1}, q7_8{0.5});
+  EXPECT_NE(q7_8{1}, q7_8{0.5});
+}
+
+TEST(fixed_point, lerp) {
+  constexpr auto y{ztl::lerp(
+    q15_16{45}, q15_16{35}, q15_16{64}, q15_16{4.3313}, q15_16{4.3944})};
+  EXPECT_NEAR(static_cast<double>(y), 4.3530, 0.0001);
+  EXPECT_EQ(ztl::lerp(q7_8{42}, q7_8{12}, q7_8{12}, q7_8{1}, q7_8{2}),
+            q7_8{1});
+}
+
+TEST(fixed_point, lerp_wide_range) {
+  EXPECT_EQ(ztl::lerp(q7_8{50}, q7_8{0}, q7_8{100}, q7_8{0}, q7_8{100}),
+            q7_8{50});
+  EXPECT_EQ(ztl::lerp(q7_8{-100}, q7_8{-120}, q7_8{120}, q7_8{127}, q7_8{-127}),
+            q7_8{105.83333});
+  EXPECT_EQ(
+    ztl::lerp(q15_16{500}, q15_16{0}, q15_16{1000}, q15_16{0}, q15_16{1000}),
+    q15_16{500});
+  EXPECT_EQ(ztl::lerp(q15_16{-20000},
+                      q15_16{-30000},
+                      q15_16{30000},
+                      q15_16{32000},
+                      q15_16{-32000}),
+            q15_16{32000.0 - 64000.0 / 6.0});
+}
+
+TEST(fixed_point, sign) {
+  EXPECT_EQ(ztl::sign(q7_8{-0.5}), -1);
+  EXPECT_EQ(ztl::sign(q7_8{}), 0);
+  EXPECT_EQ(ztl::sign(q7_8::epsilon()), 1);
+}
+
+TEST(fixed_point, make_linspace) {
+  constexpr auto values{ztl::make_linspace<7u>(q15_16{13.7}, q15_16{19.83})};
+  constexpr std::array expected{
+    13.700, 14.722, 15.743, 16.765, 17.787, 18.808, 19.830};
+  for (auto i{0u}; i < size(values); ++i)
+    EXPECT_NEAR(static_cast<double>(values[i]), expected[i], 0.001);
+}
+
+TEST(fixed_point, lerp_full_range) {
+  using q0_31 = ztl::fixed<0uz, 31uz>;
+  using q31_0 = ztl::fixed<31uz, 0uz>;
+  EXPECT_EQ(ztl::lerp(q15_16::max(),
+                      q15_16::min(),
+                      q15_16::max(),
+                      q15_16::min(),
+                      q15_16::max()),
+            q15_16::max());
+  EXPECT_EQ(ztl::lerp(q15_16::min(),
+                      q15_16::min(),
+                      q15_16::max(),
+                      q15_16::max(),
+                      q15_16::min()),
+            q15_16::max());
+  EXPECT_EQ(ztl::lerp(q0_31{},
+                      q0_31::min(),
+                      q0_31::max(),
+                      q0_31::min(),
+                      q0_31::max()),
+            q0_31{});
+  EXPECT_EQ(ztl::lerp(q31_0::max(),
+                      q31_0::min(),
+                      q31_0::max(),
+                      q31_0::max(),
+                      q31_0::min()),
+            q31_0::min());
+  // Extrapolation saturates
+  EXPECT_EQ(
+    ztl::lerp(q31_0::max(), q31_0{}, q31_0{1}, q31_0::min(), q31_0::max()),
+    q31_0::max());
+}
+
+TEST(fixed_point, make_linspace_wide_range) {
+  {
+    constexpr auto values{ztl::make_linspace<11u>(q7_8{0}, q7_8{100})};
+    for (auto i{0u}; i < size(values); ++i)
+      EXPECT_EQ(values[i], q7_8{10 * i});
+  }
+
+  {
+    constexpr auto values{
+      ztl::make_linspace<5u>(q15_16{30000}, q15_16{-30000})};
+    constexpr std::array expected{30000, 15000, 0, -15000, -30000};
+    for (auto i{0u}; i < size(values); ++i)
+      EXPECT_EQ(values[i], q15_16{expected[i]});
+  }
+}
+
+TEST(fixed_point, euclidean_mod) {
+  EXPECT_EQ(ztl::euclidean_mod(q7_8{7.5}, q7_8{2}), q7_8{1.5});
+  EXPECT_EQ(ztl::euclidean_mod(q7_8{-7.5}, q7_8{2}), q7_8{0.5});
+}
+
+TEST(fixed_point, sin_cos) {
+  for (auto x{-20.0}; x <= 20.0; x += 0.01) {
+    EXPECT_NEAR(static_cast<double>(ztl::sin(q15_16{x})),
+                std::sin(static_cast<double>(q15_16{x})),
+                0.0001);
+    EXPECT_NEAR(static_cast<double>(ztl::cos(q15_16{x})),
+                std::cos(static_cast<double>(q15_16{x})),
+                0.0001);
+  }
+  constexpr auto c{ztl::cos(ztl::fixed<1uz, 30uz>{1.0})};
+  EXPECT_NEAR(static_cast<double>(c), std::cos(1.0), 1e-8);
+}
+
+TEST(fixed_point, atan2) {
+  for (auto y{-10.0}; y <= 10.0; y += 0.1)
+    for (auto x{-10.0}; x <= 10.0; x += 0.1)
+      EXPECT_NEAR(static_cast<double>(ztl::atan2(q15_16{y}, q15_16{x})),
+                  std::atan2(static_cast<double>(q15_16{y}),
+                             static_cast<double>(q15_16{x})),
+                  0.0001);
+}
+
+TEST(fixed_point, exp) {
+  for (auto x{-10.0}; x <= 10.0; x += 0.01) {
+    auto const expected{std::exp(static_cast<double>(q15_16{x}))};
+    EXPECT_NEAR(static_cast<double>(ztl::exp(q15_16{x})),
+                expected,
+                std::max(expected * 1e-5, 0.0001));
+  }
+  EXPECT_EQ(ztl::exp(q15_16{11}), q15_16::max());
+  EXPECT_EQ(ztl::exp(q15_16{-12}), q15_16{});
+  EXPECT_EQ(ztl::exp(q7_8{5}), q7_8::max());
+  EXPECT_EQ(ztl::exp(q15_16::min()), q15_16{});
+  EXPECT_EQ(ztl::exp(ztl::fixed<31uz, 0uz>::min()), (ztl::fixed<31uz, 0uz>{}));
+  EXPECT_EQ(ztl::exp(ztl::fixed<31uz, 0uz>::max()),
+            (ztl::fixed<31uz, 0uz>::max()));
+}
+
+TEST(fixed_point, sqrt) {
+  for (auto x{0.0}; x <= 1000.0; x += 0.1)
+    EXPECT_NEAR(static_cast<double>(ztl::sqrt(q15_16{x})),
+                std::sqrt(static_cast<double>(q15_16{x})),
+                0.00001);
+  EXPECT_EQ(ztl::sqrt(q7_8{4}), q7_8{2});
+  EXPECT_EQ(ztl::sqrt(q15_16::max()), q15_16{181.01933598375618});
+}
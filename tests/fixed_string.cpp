@@ -3,7 +3,69 @@
 #include <ztl/fixed_string.hpp>
 #include <ztl/string.hpp>
 
+using ztl::operator""_fs;
+
 TEST(string, fixed_string) {
   constexpr ztl::fixed_string str{"hello world"};
   EXPECT_EQ(ztl::strlen(str.c_str()), 11uz);
 }
+
+TEST(fixed_string, size) {
+  static_assert("hello"_fs.size() == 5uz);
+  static_assert(!"hello"_fs.empty());
+  static_assert(ztl::fixed_string<0uz>{}.empty());
+  constexpr auto str{"hello"_fs};
+  std::string_view const sv{str};
+  EXPECT_EQ(sv, "hello");
+}
+
+TEST(fixed_string, compare) {
+  static_assert("abc"_fs == "abc"_fs);
+  static_assert("abc"_fs != "abcd"_fs);
+  static_assert("abc"_fs < "abd"_fs);
+  static_assert("abc"_fs < "abcd"_fs);
+  static_assert("b"_fs > "abcd"_fs);
+  static_assert("abc"_fs == "abc");
+  static_assert("abc" == "abc"_fs);
+  static_assert("abc"_fs < std::string_view{"b"});
+}
+
+TEST(fixed_string, find) {
+  constexpr auto str{"set speed 42"_fs};
+  static_assert(str.find("speed") == 4uz);
+  static_assert(str.find(' ') == 3uz);
+  static_assert(str.find(' ', 4uz) == 9uz);
+  static_assert(str.find("stop") == str.npos);
+  static_assert(str.starts_with("set"));
+  static_assert(!str.starts_with("get"));
+  static_assert(str.ends_with("42"));
+}
+
+TEST(fixed_string, substr) {
+  constexpr auto str{"set speed 42"_fs};
+  static_assert(str.substr<4uz, 5uz>() == "speed");
+  static_assert(str.substr<10uz>() == "42");
+  static_assert(str.substr<10uz, 100uz>().size() == 2uz);
+  static_assert(str.substr<12uz>().empty());
+}
+
+TEST(fixed_string, concat) {
+  constexpr auto str{
+    ztl::concat("a"_fs, "bc"_fs, ztl::fixed_string<0uz>{}, "def"_fs)};
+  static_assert(str == "abcdef");
+  static_assert(str.size() == 6uz);
+  static_assert("ab"_fs + "cd"_fs == "abcd");
+  EXPECT_STREQ(str.c_str(), "abcdef");
+}
+
+TEST(fixed_string, hash) {
+  // Reference values of 32 bit FNV-1a
+  static_assert(""_fs.hash() == 0x811C'9DC5u);
+  static_assert("a"_fs.hash() == 0xE40C'292Cu);
+  static_assert("foobar"_fs.hash() == 0xBF9C'F968u);
+  EXPECT_EQ(ztl::fnv1a(std::string_view{"foobar"}), "foobar"_fs.hash());
+
+  // Seed gets mixed into the offset basis
+  static_assert(ztl::fnv1a("", 0x811C'9DC5u) == 0u);
+  static_assert(ztl::fnv1a("foobar", 42u) != ztl::fnv1a("foobar"));
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdio>
+#include <string_view>
+#include <ztl/format.hpp>
+
+namespace {
+
+using ztl::operator""_fs;
+
+template<ztl::fixed_string Fmt, typename... Ts>
+std::string_view format_view(std::span<char> buf, Ts const&... args) {
+  auto const [ptr, ec]{ztl::format<Fmt>(buf, args...)};
+  EXPECT_EQ(ec, std::errc{});
+  return {data(buf), ptr};
+}
+
+} // namespace
+
+TEST(format, literals) {
+  std::array<char, 64uz> buf{};
+  EXPECT_EQ(format_view<"">(buf), "");
+  EXPECT_EQ(format_view<"hello world">(buf), "hello world");
+  EXPECT_EQ(format_view<"{{}}{{{}}}">(buf, 42), "{}{42}");
+}
+
+TEST(format, integers) {
+  std::array<char, 128uz> buf{};
+  EXPECT_EQ((format_view<"{} {} {} {}">(buf,
+                                        int8_t{-128},
+                                        uint16_t{65535u},
+                                        -2'000'000'000,
+                                        18'446'744'073'709'551'615ull)),
+            "-128 65535 -2000000000 18446744073709551615");
+  EXPECT_EQ((format_view<"0x{:x} 0b{:b} {:d}"_fs>(buf, 0xBEEFu, 5u, 7)),
+            "0xbeef 0b101 7");
+  EXPECT_EQ((format_view<"{} {}">(buf, true, 'c')), "true c");
+}
+
+TEST(format, floating_point) {
+  std::array<char, 128uz> buf{};
+  EXPECT_EQ(format_view<"{}">(buf, 3.5), "3.500000");
+  EXPECT_EQ(format_view<"{:.3}">(buf, 0.9996), "1.000");
+  EXPECT_EQ(format_view<"{:.1}">(buf, 1e20), "1.0e+20");
+  // Ties round half away from zero, std::format writes "2", "-0.12" and "0.2"
+  EXPECT_EQ(format_view<"{:.0}">(buf, 2.5), "3");
+  EXPECT_EQ(format_view<"{:.2}">(buf, -0.125f), "-0.13");
+  EXPECT_EQ(format_view<"{:.1}">(buf, 0.25), "0.3");
+  EXPECT_EQ((format_view<"{} {}">(buf,
+                                  std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<float>::quiet_NaN())),
+            "inf nan");
+
+  std::array<char, 64uz> printf_buf{};
+  for (auto v : {0.0, 1.0, 123.456, -98765.4321, 1e-7, 4294967296.25}) {
+    std::snprintf(data(printf_buf), size(printf_buf), "%f", v);
+    EXPECT_EQ(format_view<"{}">(buf, v), std::string_view{data(printf_buf)});
+  }
+}
+
+TEST(format, strings) {
+  std::array<char, 64uz> buf{};
+  constexpr ztl::fixed_string fs{"fixed"};
+  std::string_view const sv{"view"};
+  char const* ptr{"pointer"};
+  EXPECT_EQ((format_view<"{}, {}, {}, {}">(buf, "literal", fs, sv, ptr)),
+            "literal, fixed, view, pointer");
+}
+
+TEST(format, error_code) {
+  std::array<char, 64uz> buf{};
+  EXPECT_EQ(format_view<"{}">(buf, ztl::error_code{}), "Success");
+  EXPECT_EQ(
+    format_view<"{}">(buf, ztl::error_code{std::errc::invalid_argument}),
+    std::string_view{strerror(EINVAL)});
+}
+
+TEST(format, truncation) {
+  std::array<char, 8uz> buf{};
+  auto const [ptr, ec]{ztl::format<"value={}">(buf, 123456)};
+  EXPECT_EQ(ec, std::errc::value_too_large);
+  EXPECT_EQ(ptr, begin(buf) + 6);
+  EXPECT_EQ((std::string_view{begin(buf), ptr}), "value=");
+}
+
+TEST(format, inplace_vector) {
+  ztl::inplace_vector<char, 16uz> v;
+  EXPECT_EQ(ztl::format<"a={} ">(v, 1), std::errc{});
+  EXPECT_EQ(ztl::format<"b={}">(v, 2), std::errc{});
+  EXPECT_EQ((std::string_view{data(v), size(v)}), "a=1 b=2");
+  EXPECT_EQ(ztl::format<"{}">(v, "way too long string"),
+            std::errc::value_too_large);
+  EXPECT_TRUE(full(v));
+}
+
+TEST(format, inplace_string) {
+  ztl::inplace_string<16uz> str{"a="};
+  EXPECT_EQ(ztl::format<"{} ">(str, 1), std::errc{});
+  EXPECT_EQ(ztl::format<"b={}">(str, 2), std::errc{});
+  EXPECT_EQ(str, "a=1 b=2");
+  EXPECT_EQ(ztl::format<"{}">(str, "way too long string"),
+            std::errc::value_too_large);
+  EXPECT_TRUE(full(str));
+  EXPECT_EQ(ztl::strlen(str.c_str()), 16uz);
+}
+
+TEST(format, constexpr) {
+  static_assert([] {
+    std::array<char, 16uz> buf{};
+    auto const ptr{ztl::format<"{}-{:x}">(buf, 12, 255u).ptr};
+    return std::string_view{data(buf), ptr} == "12-ff";
+  }());
+}
@@ -0,0 +1,133 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <ztl/hysteresis_latch.hpp>
+
+namespace {
+
+template<typename T, typename U>
+concept resettable_with = requires(T t, U u) { t.reset(u); };
+
+} // namespace
+
+TEST(hysteresis_latch, ctor) {
+  {
+    ztl::hysteresis_latch<int> hl;
+    EXPECT_FALSE(hl);
+  }
+
+  {
+    ztl::hysteresis_latch<float> hl{1.0f, 2.0f, true};
+    EXPECT_TRUE(hl);
+  }
+}
+
+TEST(hysteresis_latch, set) {
+  ztl::hysteresis_latch<int> hl{10, 20};
+
+  // Samples between the thresholds don't change the value
+  hl.set(15);
+  EXPECT_FALSE(hl);
+  hl.set(19);
+  EXPECT_FALSE(hl);
+
+  // Reaching the upper threshold latches true
+  hl.set(20);
+  EXPECT_TRUE(hl);
+  hl.set(11);
+  EXPECT_TRUE(hl);
+  hl.set(25);
+  EXPECT_TRUE(hl);
+
+  // Reaching the lower threshold doesn't latch false, falling below does
+  hl.set(10);
+  EXPECT_TRUE(hl);
+  hl.set(9);
+  EXPECT_FALSE(hl);
+  hl.set(19);
+  EXPECT_FALSE(hl);
+}
+
+TEST(hysteresis_latch, set_counted) {
+  ztl::hysteresis_latch<int, 3uz> hl{10, 20};
+
+  // Reaching the upper threshold 3 times latches true
+  hl.set(20); // 1
+  hl.set(21); // 2
+  EXPECT_FALSE(hl);
+  hl.set(22); // 3
+  EXPECT_TRUE(hl);
+
+  // A sample above the lower threshold resets the count
+  hl.set(5);  // 1
+  hl.set(5);  // 2
+  hl.set(15); // 0
+  hl.set(5);  // 1
+  hl.set(5);  // 2
+  EXPECT_TRUE(hl);
+  hl.set(5); // 3
+  EXPECT_FALSE(hl);
+}
+
+TEST(hysteresis_latch, reset) {
+  ztl::hysteresis_latch<int, 2uz> hl{10, 20};
+  hl.set(20);
+  hl.reset();
+  hl.set(20);
+  EXPECT_FALSE(hl);
+
+  hl.reset(true);
+  EXPECT_TRUE(hl);
+  EXPECT_FALSE((resettable_with<decltype(hl), int>));
+
+  hl.reset(0, 5);
+  hl.set(-1);
+  hl.set(-1);
+  EXPECT_FALSE(hl);
+  hl.set(5);
+  hl.set(5);
+  EXPECT_TRUE(hl);
+}
+
+TEST(hysteresis_latch, set_returns_change) {
+  {
+    ztl::hysteresis_latch<int> hl{10, 20};
+    EXPECT_FALSE(hl.set(15));
+    EXPECT_TRUE(hl.set(20));
+    EXPECT_FALSE(hl.set(20));
+    EXPECT_FALSE(hl.set(10));
+    EXPECT_TRUE(hl.set(9));
+  }
+
+  {
+    ztl::hysteresis_latch<int, 2uz> hl{10, 20};
+    EXPECT_FALSE(hl.set(20));
+    EXPECT_TRUE(hl.set(20));
+    EXPECT_FALSE(hl.set(20));
+  }
+}
+
+TEST(hysteresis_latch, samples_at_thresholds_dont_oscillate) {
+  {
+    ztl::hysteresis_latch<int> hl;
+    for (auto i{0uz}; i < 4uz; ++i) hl.set(0);
+    EXPECT_TRUE(hl);
+  }
+
+  {
+    ztl::hysteresis_latch<int> hl{10, 10};
+    EXPECT_TRUE(hl.set(10));
+    EXPECT_FALSE(hl.set(10));
+    EXPECT_FALSE(hl.set(10));
+    EXPECT_TRUE(hl.set(9));
+    EXPECT_FALSE(hl.set(9));
+  }
+
+  {
+    ztl::hysteresis_latch<float, 2uz> hl{1.0f, 2.0f};
+    for (auto i{0uz}; i < 4uz; ++i) EXPECT_FALSE(hl.set(NAN));
+    hl.reset(true);
+    for (auto i{0uz}; i < 4uz; ++i) EXPECT_FALSE(hl.set(NAN));
+    EXPECT_TRUE(hl);
+  }
+}
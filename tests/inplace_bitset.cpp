@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <ztl/inplace_bitset.hpp>
+
+TEST(inplace_bitset, word_type) {
+  EXPECT_TRUE((std::same_as<ztl::inplace_bitset<5uz>::word_type, uint8_t>));
+  EXPECT_TRUE((std::same_as<ztl::inplace_bitset<16uz>::word_type, uint16_t>));
+  EXPECT_TRUE((std::same_as<ztl::inplace_bitset<17uz>::word_type, uint32_t>));
+  EXPECT_EQ(ztl::inplace_bitset<200uz>::words,
+            (200uz + std::numeric_limits<size_t>::digits - 1uz) /
+              std::numeric_limits<size_t>::digits);
+}
+
+TEST(inplace_bitset, set_reset_flip) {
+  ztl::inplace_bitset<100uz> b;
+  EXPECT_TRUE(b.none());
+  b.set(0uz).set(63uz).set(64uz).set(99uz);
+  EXPECT_TRUE(b.test(0uz));
+  EXPECT_TRUE(b[63uz]);
+  EXPECT_TRUE(b[64uz]);
+  EXPECT_TRUE(b[99uz]);
+  EXPECT_FALSE(b[1uz]);
+  EXPECT_EQ(b.count(), 4uz);
+  b.reset(63uz);
+  EXPECT_EQ(b.count(), 3uz);
+  b.flip();
+  EXPECT_EQ(b.count(), 97uz);
+  b.set();
+  EXPECT_TRUE(b.all());
+  b.reset();
+  EXPECT_TRUE(b.none());
+}
+
+TEST(inplace_bitset, range) {
+  ztl::inplace_bitset<150uz> b;
+  b.set_range(3uz, 140uz);
+  EXPECT_EQ(b.count(), 137uz);
+  EXPECT_FALSE(b[2uz]);
+  EXPECT_TRUE(b[3uz]);
+  EXPECT_TRUE(b[139uz]);
+  EXPECT_FALSE(b[140uz]);
+  b.reset_range(10uz, 70uz);
+  EXPECT_EQ(b.count(), 77uz);
+  EXPECT_TRUE(b[9uz]);
+  EXPECT_FALSE(b[10uz]);
+  EXPECT_FALSE(b[69uz]);
+  EXPECT_TRUE(b[70uz]);
+
+  ztl::inplace_bitset<8uz> small;
+  small.set_range(0uz, 8uz);
+  EXPECT_TRUE(small.all());
+  small.reset_range(2uz, 2uz);
+  EXPECT_TRUE(small.all());
+}
+
+TEST(inplace_bitset, find) {
+  ztl::inplace_bitset<130uz> b;
+  EXPECT_EQ(b.find_first(), 130uz);
+  EXPECT_EQ(b.find_first_unset(), 0uz);
+  b.set(5uz).set(64uz).set(129uz);
+  EXPECT_EQ(b.find_first(), 5uz);
+  EXPECT_EQ(b.find_next(5uz), 64uz);
+  EXPECT_EQ(b.find_next(64uz), 129uz);
+  EXPECT_EQ(b.find_next(129uz), 130uz);
+  b.set_range(0uz, 70uz);
+  EXPECT_EQ(b.find_first_unset(), 70uz);
+  EXPECT_EQ(b.find_next_unset(128uz), 130uz);
+  b.set();
+  EXPECT_EQ(b.find_first_unset(), 130uz);
+}
+
+TEST(inplace_bitset, iterate) {
+  ztl::inplace_bitset<70uz> b{0b1001'0110ull};
+  b.set(69uz);
+  std::vector<size_t> indices;
+  for (auto i : b) indices.push_back(i);
+  EXPECT_EQ(indices, (std::vector<size_t>{1uz, 2uz, 4uz, 7uz, 69uz}));
+  using iterator = ztl::inplace_bitset<70uz>::iterator;
+  EXPECT_TRUE(std::forward_iterator<iterator>);
+  EXPECT_TRUE((std::same_as<std::iterator_traits<iterator>::iterator_category,
+                            std::input_iterator_tag>));
+}
+
+TEST(inplace_bitset, bitwise) {
+  ztl::inplace_bitset<12uz> a{0b1100'1100'1100ull};
+  ztl::inplace_bitset<12uz> b{0b1010'1010'1010ull};
+  EXPECT_EQ(a & b, ztl::inplace_bitset<12uz>{0b1000'1000'1000ull});
+  EXPECT_EQ(a | b, ztl::inplace_bitset<12uz>{0b1110'1110'1110ull});
+  EXPECT_EQ(a ^ b, ztl::inplace_bitset<12uz>{0b0110'0110'0110ull});
+  EXPECT_EQ(~a, ztl::inplace_bitset<12uz>{0b0011'0011'0011ull});
+  EXPECT_EQ((~a).count(), 6uz);
+}
+
+TEST(inplace_bitset, constexpr) {
+  constexpr auto b{ztl::inplace_bitset<40uz>{}.set_range(8uz, 16uz)};
+  static_assert(b.count() == 8uz);
+  static_assert(b.find_first() == 8uz);
+  static_assert(b.find_next(15uz) == 40uz);
+}
@@ -246,6 +246,41 @@ TEST(inplace_deque, iterator_arithmetic_negative_subtraction) {
     EXPECT_EQ((b), (a) + ((b) - (a)));                                         \
   } while (0);
 
+TEST(inplace_deque, iterator_arithmetic_non_power_of_2_storage) {
+  // Storage of 7 elements, begin points to index 5
+  ztl::inplace_deque<int, 6uz> c;
+  for (auto i{0}; i < 5; ++i) {
+    c.push_back(-1);
+    c.pop_front();
+  }
+  for (auto i{0}; i < 6; ++i) c.push_back(i);
+
+  auto const first{begin(c)};
+  for (auto n{-30}; n <= 30; ++n) {
+    auto const expected{(((5 + n) % 7) + 7) % 7};
+    auto it{first};
+    it += n;
+    EXPECT_EQ(&*(first + n), &*begin(c) - 5 + expected);
+    EXPECT_EQ(&*(first - -n), &*begin(c) - 5 + expected);
+    EXPECT_EQ(&*it, &*begin(c) - 5 + expected);
+    it -= n;
+    EXPECT_EQ(it, first);
+  }
+}
+
+TEST(inplace_deque, iterator_arithmetic_large_offset) {
+  // Storage of 7 elements, begin points to index 0
+  ztl::inplace_deque<int, 6uz> c{0, 1, 2, 3, 4, 5};
+  auto const first{begin(c)};
+  for (auto const n : {std::numeric_limits<ptrdiff_t>::max(),
+                       std::numeric_limits<ptrdiff_t>::min(),
+                       ptrdiff_t{1} << 40,
+                       -(ptrdiff_t{1} << 40)}) {
+    auto const expected{((n % 7) + 7) % 7};
+    EXPECT_EQ(&*(first + n), &*first + expected);
+  }
+}
+
 TEST(inplace_deque, iterator_difference_read_index_less_or_equal_write_index) {
   ztl::inplace_deque c{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
   c.pop_front();
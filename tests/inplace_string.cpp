@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <ztl/inplace_string.hpp>
+#include <ztl/string.hpp>
+
+using namespace std::literals;
+using ztl::operator""_fs;
+
+TEST(inplace_string, ctor) {
+  ztl::inplace_string<8uz> default_ctor;
+  EXPECT_TRUE(empty(default_ctor));
+  EXPECT_STREQ(default_ctor.c_str(), "");
+
+  ztl::inplace_string<8uz> str_ctor{"abc"};
+  EXPECT_EQ(size(str_ctor), 3uz);
+  EXPECT_EQ(str_ctor.capacity(), 8uz);
+  EXPECT_STREQ(str_ctor.c_str(), "abc");
+
+  ztl::inplace_string<8uz> string_view_ctor{"abcdef"sv.substr(2uz)};
+  EXPECT_EQ(string_view_ctor, "cdef");
+
+  ztl::inplace_string ctad{"abc"};
+  EXPECT_EQ(ctad.capacity(), 3uz);
+  EXPECT_TRUE(full(ctad));
+
+  ztl::inplace_string fixed_string_ctad{"abcd"_fs};
+  EXPECT_EQ(fixed_string_ctad.capacity(), 4uz);
+  EXPECT_EQ(fixed_string_ctad, "abcd");
+}
+
+TEST(inplace_string, size_type) {
+  static_assert(sizeof(ztl::inplace_string<255uz>::size_type) == 1uz);
+  static_assert(sizeof(ztl::inplace_string<256uz>::size_type) == 2uz);
+  static_assert(sizeof(ztl::inplace_string<31uz>) == 33uz);
+}
+
+TEST(inplace_string, append) {
+  ztl::inplace_string<12uz> str;
+  str.append("foo").append(3u, '.');
+  str += "bar"sv;
+  str += '!';
+  EXPECT_EQ(str, "foo...bar!");
+  EXPECT_EQ(ztl::strlen(str.c_str()), size(str));
+
+  str.pop_back();
+  EXPECT_EQ(str.back(), 'r');
+  EXPECT_STREQ(str.c_str(), "foo...bar");
+
+  str.push_back('s');
+  EXPECT_EQ(str, "foo...bars");
+
+  str.clear();
+  EXPECT_TRUE(empty(str));
+  EXPECT_STREQ(str.c_str(), "");
+
+  // Appending past capacity causes undefined behavior
+  str.append("0123456789ab");
+  EXPECT_TRUE(full(str));
+#ifndef NDEBUG
+  EXPECT_DEATH(str.push_back('c'), "");
+#endif
+}
+
+TEST(inplace_string, resize) {
+  ztl::inplace_string<8uz> str{"abcdef"};
+  str.resize(3u);
+  EXPECT_STREQ(str.c_str(), "abc");
+  str.resize(5u, 'x');
+  EXPECT_STREQ(str.c_str(), "abcxx");
+}
+
+TEST(inplace_string, resize_and_overwrite) {
+  ztl::inplace_string<20uz> str{"n="};
+  str.resize_and_overwrite(str.capacity(), [&](char* ptr, size_t count) {
+    return ztl::to_chars(ptr + size(str), ptr + count, -12345).ptr - ptr;
+  });
+  EXPECT_EQ(str, "n=-12345");
+  EXPECT_STREQ(str.c_str(), "n=-12345");
+  EXPECT_EQ(ztl::atoi(str.c_str() + 2), -12345);
+}
+
+TEST(inplace_string, compare) {
+  ztl::inplace_string<8uz> a{"abc"};
+  ztl::inplace_string<16uz> b{"abd"};
+  EXPECT_NE(a, b);
+  EXPECT_LT(a, b);
+  EXPECT_EQ(a, "abc"sv);
+  EXPECT_GT(b, "abc"sv);
+  EXPECT_EQ(ztl::strcmp(a.c_str(), "abc"), 0);
+}
+
+TEST(inplace_string, find) {
+  ztl::inplace_string<16uz> str{"hello world"};
+  EXPECT_EQ(str.find("world"), 6uz);
+  EXPECT_EQ(str.find('o', 5uz), 7uz);
+  EXPECT_EQ(str.find('x'), str.npos);
+  EXPECT_TRUE(str.starts_with("hello"));
+  EXPECT_TRUE(str.ends_with("world"));
+  EXPECT_EQ(ztl::strstr(str.c_str(), "wor"), str.c_str() + 6);
+}
+
+TEST(inplace_string, constexpr) {
+  static_assert([] {
+    ztl::inplace_string<8uz> str{"ab"};
+    str += "cd";
+    str.push_back('e');
+    return str == "abcde"sv;
+  }());
+}
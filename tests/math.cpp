@@ -1,5 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
 #include <ztl/math.hpp>
 
 TEST(math, align) {
@@ -12,12 +14,113 @@ TEST(math, align) {
   EXPECT_EQ(64u, ztl::align(32u, 64u));
 }
 
+TEST(math, align_up) {
+  EXPECT_EQ(0u, ztl::align_up(4u, 0u));
+  EXPECT_EQ(4u, ztl::align_up(4u, 3u));
+  EXPECT_EQ(4u, ztl::align_up(4u, 4u));
+  EXPECT_EQ(64u, ztl::align_up(32u, 33u));
+  EXPECT_EQ(256uz, ztl::align_up(256uz, 1uz));
+  EXPECT_EQ(0x1'0000'0000ull, ztl::align_up(0x1000ull, 0xFFFF'F001ull));
+}
+
+TEST(math, align_down) {
+  EXPECT_EQ(0u, ztl::align_down(4u, 0u));
+  EXPECT_EQ(0u, ztl::align_down(4u, 3u));
+  EXPECT_EQ(4u, ztl::align_down(4u, 4u));
+  EXPECT_EQ(32u, ztl::align_down(32u, 63u));
+  EXPECT_EQ(0xFFFF'F000ull, ztl::align_down(0x1000ull, 0xFFFF'FFFFull));
+}
+
+TEST(math, align_non_power_of_2) {
+  EXPECT_EQ(0u, ztl::align(3u, 0u));
+  EXPECT_EQ(3u, ztl::align(3u, 1u));
+  EXPECT_EQ(12u, ztl::align(6u, 7u));
+  EXPECT_EQ(12u, ztl::align(6u, 12u));
+}
+
+TEST(math, ceil_log2) {
+  EXPECT_EQ(ztl::ceil_log2(1u), 0u);
+  EXPECT_EQ(ztl::ceil_log2(2u), 1u);
+  EXPECT_EQ(ztl::ceil_log2(3u), 2u);
+  EXPECT_EQ(ztl::ceil_log2(static_cast<uint8_t>(255u)), 8u);
+  EXPECT_EQ(ztl::ceil_log2(1024u), 10u);
+  EXPECT_EQ(ztl::ceil_log2(1025u), 11u);
+  EXPECT_EQ(ztl::ceil_log2(0x8000'0000'0000'0001ull), 64u);
+  EXPECT_EQ(ztl::ceil_log2(5), 3u);
+  EXPECT_EQ(ztl::ceil_log2(int64_t{1} << 40), 40u);
+  EXPECT_TRUE((std::same_as<decltype(ztl::ceil_log2(8)), uint32_t>));
+}
+
 TEST(math, digit) {
   EXPECT_EQ(ztl::tens_digit(225), 2);
   EXPECT_EQ(ztl::tens_digit(4238261u), 6u);
   EXPECT_EQ(ztl::tens_digit(12813968329378591287ull), 8u);
 }
 
+TEST(math, euclidean_mod) {
+  EXPECT_EQ(ztl::euclidean_mod(7, 3), 1);
+  EXPECT_EQ(ztl::euclidean_mod(-7, 3), 2);
+  EXPECT_EQ(ztl::euclidean_mod(-7, -3), 2);
+  EXPECT_EQ(ztl::euclidean_mod(7u, 3u), 1u);
+}
+
+TEST(math, euclidean_mod_constant_divisor) {
+  auto const test{[]<auto... Ds>() {
+    (
+      [] {
+        for (auto i{0u}; i <= std::numeric_limits<uint16_t>::max(); ++i) {
+          auto const u8{static_cast<uint8_t>(i)};
+          EXPECT_EQ(ztl::euclidean_mod<Ds>(u8),
+                    ztl::euclidean_mod<uint8_t>(u8, Ds));
+          auto const u16{static_cast<uint16_t>(i)};
+          EXPECT_EQ(ztl::euclidean_mod<Ds>(u16),
+                    ztl::euclidean_mod<uint16_t>(u16, Ds));
+          auto const u32{i * 65'537u};
+          EXPECT_EQ(ztl::euclidean_mod<Ds>(u32), ztl::euclidean_mod(u32, Ds));
+          auto const u64{i * 0x1'0001'0001'0001ull};
+          EXPECT_EQ(ztl::euclidean_mod<Ds>(u64),
+                    ztl::euclidean_mod<uint64_t>(u64, Ds));
+          auto const i32{static_cast<int32_t>(i) - 32'768};
+          EXPECT_EQ(ztl::euclidean_mod<Ds>(i32),
+                    ztl::euclidean_mod<int32_t>(i32, Ds));
+          auto const i64{static_cast<int64_t>(i32) * 0x1'0001'0001ll};
+          EXPECT_EQ(ztl::euclidean_mod<Ds>(i64),
+                    ztl::euclidean_mod<int64_t>(i64, Ds));
+        }
+      }(),
+      ...);
+  }};
+  test.template operator()<1u, 2u, 3u, 7u, 10u, 16u, 100u, 127u, 128u, 255u>();
+}
+
+TEST(math, euclidean_mod_constant_16_bit_divisor) {
+  auto const test{[]<auto... Ds>() {
+    (
+      [] {
+        for (auto i{0u}; i <= std::numeric_limits<uint16_t>::max(); ++i)
+          for (auto const u32 : {i * 65'537u, ~(i * 65'537u), i * 40'503u}) {
+            EXPECT_EQ(ztl::euclidean_mod<Ds>(u32), ztl::euclidean_mod(u32, Ds));
+          }
+      }(),
+      ...);
+  }};
+  test.template operator()<257u, 1000u, 4095u, 65'521u, 65'535u>();
+}
+
+TEST(math, floor_log2) {
+  EXPECT_EQ(ztl::floor_log2(1u), 0u);
+  EXPECT_EQ(ztl::floor_log2(2u), 1u);
+  EXPECT_EQ(ztl::floor_log2(3u), 1u);
+  EXPECT_EQ(ztl::floor_log2(static_cast<uint8_t>(255u)), 7u);
+  EXPECT_EQ(ztl::floor_log2(static_cast<uint16_t>(256u)), 8u);
+  EXPECT_EQ(ztl::floor_log2(1025u), 10u);
+  EXPECT_EQ(ztl::floor_log2(0xFFFF'FFFF'FFFF'FFFFull), 63u);
+  EXPECT_EQ(ztl::floor_log2(8), 3u);
+  EXPECT_EQ(ztl::floor_log2(int8_t{127}), 6u);
+  EXPECT_TRUE((std::same_as<decltype(ztl::floor_log2(uint16_t{})), uint32_t>));
+  EXPECT_TRUE((std::same_as<decltype(ztl::floor_log2(8)), uint32_t>));
+}
+
 TEST(math, hundreds_digit) {
   EXPECT_EQ(ztl::hundreds_digit(225), 2);
   EXPECT_EQ(ztl::hundreds_digit(4238261u), 2u);
@@ -35,6 +138,26 @@ TEST(math, lerp_x1_x2_equal) {
   EXPECT_EQ(y, 100);
 }
 
+TEST(math, lerp_span) {
+  {
+    constexpr std::array x{35.0, 40.0, 45.0, 50.0, 64.0};
+    std::array<double, size(x)> y{};
+    ztl::lerp(x, 35.0, 64.0, 4.3313, 4.3944, y);
+    for (auto i{0uz}; i < size(x); ++i)
+      EXPECT_EQ(y[i], ztl::lerp(x[i], 35.0, 64.0, 4.3313, 4.3944));
+  }
+
+  {
+    constexpr std::array x{-10, 0, 42, 128, 200};
+    std::array<int, size(x)> y{};
+    ztl::lerp(x, 0, 128, 100, 200, y);
+    for (auto i{0uz}; i < size(x); ++i)
+      EXPECT_EQ(y[i], ztl::lerp(x[i], 0, 128, 100, 200));
+    ztl::lerp(x, 128, 128, 100, 200, y);
+    EXPECT_THAT(y, testing::Each(100));
+  }
+}
+
 TEST(math, make_linspace) {
   constexpr auto error{0.001};
 
@@ -52,6 +175,12 @@ TEST(math, make_linspace) {
     for (auto i{0u}; i < size(values); ++i)
       EXPECT_NEAR(values[i], expected[i], error);
   }
+
+  {
+    constexpr auto values{ztl::make_linspace<4096u>(0.0, 4095.0)};
+    for (auto i{0u}; i < size(values); ++i)
+      EXPECT_NEAR(values[i], static_cast<double>(i), error);
+  }
 }
 
 TEST(math, ones_digit) {
@@ -60,8 +189,149 @@ TEST(math, ones_digit) {
   EXPECT_EQ(ztl::ones_digit(12813968329378591287ull), 7u);
 }
 
+TEST(math, pow2) {
+  EXPECT_EQ(ztl::pow2(0u), 1u);
+  EXPECT_EQ(ztl::pow2(1u), 2u);
+  EXPECT_EQ(ztl::pow2(static_cast<uint8_t>(7u)), 128u);
+  EXPECT_EQ(ztl::pow2(31u), 0x8000'0000u);
+  EXPECT_EQ(ztl::pow2(63ull), 0x8000'0000'0000'0000ull);
+  EXPECT_EQ(ztl::pow2(3), 8u);
+  EXPECT_EQ(ztl::pow2(uint8_t{10}), 1024u);
+  EXPECT_EQ(ztl::pow2(int64_t{40}), 1ull << 40u);
+  EXPECT_TRUE((std::same_as<decltype(ztl::pow2(3)), uint32_t>));
+  EXPECT_TRUE((std::same_as<decltype(ztl::pow2(uint8_t{})), uint32_t>));
+  EXPECT_TRUE((std::same_as<decltype(ztl::pow2(0ull)), unsigned long long>));
+}
+
 TEST(math, tens_digit) {
   EXPECT_EQ(ztl::tens_digit(225), 2);
   EXPECT_EQ(ztl::tens_digit(4238261u), 6u);
   EXPECT_EQ(ztl::tens_digit(12813968329378591287ull), 8u);
 }
+
+namespace {
+
+template<typename T, typename F, typename G>
+void expect_near_range(F f, G g, T first, T last, T step, T error) {
+  for (auto x{first}; x <= last; x += step) EXPECT_NEAR(f(x), g(x), error);
+}
+
+} // namespace
+
+TEST(math, sin) {
+  static_assert(ztl::sin(0.0) == 0.0);
+  expect_near_range(
+    [](double x) { return ztl::sin(x); },
+    [](double x) { return std::sin(x); },
+    -100.0,
+    100.0,
+    0.001,
+    1e-14);
+  expect_near_range(
+    [](float x) { return ztl::sin(x); },
+    [](float x) { return std::sin(x); },
+    -10.0f,
+    10.0f,
+    0.001f,
+    1e-6f);
+  EXPECT_TRUE(std::isnan(ztl::sin(std::numeric_limits<double>::infinity())));
+}
+
+TEST(math, sin_cos_near_float_reduction_bound) {
+  for (auto x{4000.0f}; x < 4096.0f; x += 0.1f) {
+    EXPECT_NEAR(ztl::sin(x), std::sin(static_cast<double>(x)), 2e-7);
+    EXPECT_NEAR(ztl::cos(x), std::cos(static_cast<double>(x)), 2e-7);
+  }
+}
+
+TEST(math, sin_cos_large_argument) {
+  EXPECT_TRUE(std::isnan(ztl::sin(1e30f)));
+  EXPECT_TRUE(std::isnan(ztl::cos(-1e30f)));
+  EXPECT_TRUE(std::isnan(ztl::sin(4096.0f)));
+  EXPECT_TRUE(std::isnan(ztl::sin(1e300)));
+  EXPECT_TRUE(std::isnan(ztl::cos(0x1p20)));
+  EXPECT_NEAR(ztl::sin(0x1p20 - 1.0), std::sin(0x1p20 - 1.0), 1e-10);
+}
+
+TEST(math, cos) {
+  static_assert(ztl::cos(0.0) == 1.0);
+  expect_near_range(
+    [](double x) { return ztl::cos(x); },
+    [](double x) { return std::cos(x); },
+    -100.0,
+    100.0,
+    0.001,
+    1e-14);
+  expect_near_range(
+    [](float x) { return ztl::cos(x); },
+    [](float x) { return std::cos(x); },
+    -10.0f,
+    10.0f,
+    0.001f,
+    1e-6f);
+}
+
+TEST(math, sin_table) {
+  constexpr auto table{std::invoke(
+    []<size_t... Is>(std::index_sequence<Is...>) {
+      return std::array{ztl::sin(static_cast<double>(Is) * 2.0 *
+                                 std::numbers::pi / 64.0)...};
+    },
+    std::make_index_sequence<64uz>{})};
+  for (auto i{0uz}; i < size(table); ++i)
+    EXPECT_NEAR(table[i],
+                std::sin(static_cast<double>(i) * 2.0 * std::numbers::pi /
+                         64.0),
+                1e-15);
+}
+
+TEST(math, exp) {
+  static_assert(ztl::exp(0.0) == 1.0);
+  for (auto x{-700.0}; x <= 700.0; x += 0.01)
+    EXPECT_NEAR(ztl::exp(x) / std::exp(x), 1.0, 1e-14);
+  for (auto x{-80.0f}; x <= 80.0f; x += 0.01f)
+    EXPECT_NEAR(ztl::exp(x) / std::exp(x), 1.0f, 1e-6f);
+  EXPECT_EQ(ztl::exp(710.0), std::numeric_limits<double>::infinity());
+  EXPECT_EQ(ztl::exp(-750.0), 0.0);
+  EXPECT_NEAR(ztl::exp(-740.0) / std::exp(-740.0), 1.0, 1e-5);
+}
+
+TEST(math, sqrt) {
+  static_assert(ztl::sqrt(4.0) == 2.0);
+  for (auto x{0.0}; x <= 1000.0; x += 0.01)
+    EXPECT_DOUBLE_EQ(ztl::sqrt(x), std::sqrt(x));
+  for (auto x{0.0f}; x <= 1000.0f; x += 0.01f)
+    EXPECT_FLOAT_EQ(ztl::sqrt(x), std::sqrt(x));
+  EXPECT_DOUBLE_EQ(ztl::sqrt(1e300), std::sqrt(1e300));
+  EXPECT_DOUBLE_EQ(ztl::sqrt(5e-320), std::sqrt(5e-320));
+  EXPECT_FLOAT_EQ(ztl::sqrt(1e-40f), std::sqrt(1e-40f));
+  EXPECT_TRUE(std::isnan(ztl::sqrt(-1.0)));
+}
+
+TEST(math, atan2) {
+  static_assert(ztl::atan2(0.0, 1.0) == 0.0);
+  for (auto y{-10.0}; y <= 10.0; y += 0.05)
+    for (auto x{-10.0}; x <= 10.0; x += 0.05) {
+      EXPECT_NEAR(ztl::atan2(y, x), std::atan2(y, x), 1e-15);
+      auto const yf{static_cast<float>(y)};
+      auto const xf{static_cast<float>(x)};
+      EXPECT_NEAR(ztl::atan2(yf, xf), std::atan2(yf, xf), 1e-6f);
+    }
+}
+
+TEST(math, atan2_signed_zero_and_infinity) {
+  constexpr auto inf{std::numeric_limits<double>::infinity()};
+  constexpr std::array values{0.0, -0.0, 1.0, -1.0, inf, -inf};
+  for (auto y : values)
+    for (auto x : values) {
+      auto const expected{std::atan2(y, x)};
+      EXPECT_NEAR(ztl::atan2(y, x), expected, 1e-15);
+      EXPECT_EQ(std::signbit(ztl::atan2(y, x)), std::signbit(expected));
+      auto const yf{static_cast<float>(y)};
+      auto const xf{static_cast<float>(x)};
+      auto const expectedf{std::atan2(yf, xf)};
+      EXPECT_NEAR(ztl::atan2(yf, xf), expectedf, 1e-6f);
+      EXPECT_EQ(std::signbit(ztl::atan2(yf, xf)), std::signbit(expectedf));
+    }
+  static_assert(ztl::atan2(-0.0, -1.0) == -std::numbers::pi);
+}
@@ -42,3 +42,23 @@ TEST(spline, spline) {
   EXPECT_NEAR(sy[120uz], 55908.5009727030, error);
   EXPECT_NEAR(sy[127uz], 61440, error);
 }
+
+// Updating a single knot equals rebuilding all splines
+TEST(spline, update_knot) {
+  constexpr std::array x{1.0, 16.0, 32.0, 48.0, 64.0, 96.0, 128.0};
+  std::array y{512.0, 4096.0, 8192.0, 12288.0, 20480.0, 40960.0, 61440.0};
+  ztl::hermite_splines hs{x, y};
+
+  constexpr auto error{0.0000001};
+
+  for (auto i{0uz}; i < size(y); ++i) {
+    y[i] = i % 2uz ? y[i] / 3.0 : y[i] * 1.5;
+    hs.update_knot(i, y[i]);
+    auto const expected{ztl::make_hermite_splines(x, y)};
+    for (auto j{0uz}; j < size(expected); ++j) {
+      EXPECT_NEAR(hs.splines()[j].a3, expected[j].a3, error);
+      EXPECT_NEAR(hs.splines()[j].a2, expected[j].a2, error);
+      EXPECT_NEAR(hs.splines()[j].a1, expected[j].a1, error);
+    }
+  }
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <ztl/static_map.hpp>
+
+using ztl::operator""_fs;
+
+namespace {
+
+enum class Command { Get, Set, Reset, Help };
+
+using commands = ztl::static_map<ztl::key_value{"get"_fs, Command::Get},
+                                 ztl::key_value{"set"_fs, Command::Set},
+                                 ztl::key_value{"reset"_fs, Command::Reset},
+                                 ztl::key_value{"help"_fs, Command::Help}>;
+
+template<size_t I>
+constexpr auto make_key() {
+  ztl::fixed_string<3uz> digits{};
+  digits._str[0uz] = static_cast<char>('0' + I / 100uz);
+  digits._str[1uz] = static_cast<char>('0' + I / 10uz % 10uz);
+  digits._str[2uz] = static_cast<char>('0' + I % 10uz);
+  return "key"_fs + digits;
+}
+
+template<size_t... Is>
+constexpr auto make_map(std::index_sequence<Is...>) {
+  return ztl::static_map<ztl::key_value{make_key<Is>(), Is}...>{};
+}
+
+} // namespace
+
+TEST(static_map, find) {
+  EXPECT_EQ(commands::size(), 4uz);
+  EXPECT_EQ(*commands::find("get"), Command::Get);
+  EXPECT_EQ(*commands::find(std::string{"reset"}), Command::Reset);
+  EXPECT_EQ(commands::find("gets"), nullptr);
+  EXPECT_EQ(commands::find(""), nullptr);
+  EXPECT_TRUE(commands::contains("help"));
+  EXPECT_FALSE(commands::contains("hel"));
+  EXPECT_EQ(commands::index_of("set"), 1uz);
+  EXPECT_EQ(commands::index_of("unset"), commands::npos);
+  static_assert(*commands::find("set") == Command::Set);
+}
+
+TEST(static_map, many_keys) {
+  using map = decltype(make_map(std::make_index_sequence<256uz>{}));
+  for (auto i{0uz}; i < map::size(); ++i) {
+    auto const key{make_key<0uz>()};
+    std::string str{key.c_str()};
+    str[3uz] = static_cast<char>('0' + i / 100uz);
+    str[4uz] = static_cast<char>('0' + i / 10uz % 10uz);
+    str[5uz] = static_cast<char>('0' + i % 10uz);
+    EXPECT_EQ(*map::find(str), i);
+  }
+  EXPECT_FALSE(map::contains("key256"));
+  EXPECT_FALSE(map::contains("key"));
+}
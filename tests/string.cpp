@@ -1,5 +1,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
 #include <ztl/string.hpp>
 
 TEST(string, atoi) {
@@ -17,6 +20,24 @@ TEST(string, strcmp) {
   EXPECT_LT(0, ztl::strcmp("b", "a"));
 }
 
+TEST(string, strcmp_words) {
+  // Cover all relative alignments of lhs and rhs
+  alignas(16) std::array<char, 64uz> lhs{};
+  alignas(16) std::array<char, 64uz> rhs{};
+  for (auto i{0uz}; i < 16uz; ++i)
+    for (auto j{0uz}; j < 16uz; ++j) {
+      std::ranges::fill(lhs, '\0');
+      std::ranges::fill(rhs, '\0');
+      for (auto k{0uz}; k < 40uz; ++k)
+        lhs[i + k] = rhs[j + k] = static_cast<char>('a' + k % 26uz);
+      EXPECT_EQ(ztl::strcmp(&lhs[i], &rhs[j]), 0);
+      rhs[j + 33uz] = '\xFF';
+      EXPECT_LT(ztl::strcmp(&lhs[i], &rhs[j]), 0);
+      EXPECT_GT(ztl::strcmp(&rhs[j], &lhs[i]), 0);
+    }
+  static_assert(ztl::strcmp("abc", "abd") < 0);
+}
+
 TEST(string, strcpy) {
   constexpr auto src{"copy this string pls"};
   std::array<char, ztl::strlen(src) + 1uz> dest{};
@@ -27,6 +48,36 @@ TEST(string, strcpy) {
 TEST(string, strlen) {
   EXPECT_EQ(ztl::strlen("hello world"), 11uz);
   EXPECT_EQ(ztl::strlen("hello\nworld\n"), 12uz);
+  static_assert(ztl::strlen("hello") == 5uz);
+}
+
+TEST(string, strlen_words) {
+  alignas(16) std::array<char, 64uz> str{};
+  for (auto i{0uz}; i < 16uz; ++i)
+    for (auto len{0uz}; len < 40uz; ++len) {
+      std::ranges::fill(str, '\0');
+      std::fill_n(&str[i], len, '\x80');
+      EXPECT_EQ(ztl::strlen(&str[i]), len);
+    }
+}
+
+TEST(string, strchr) {
+  constexpr auto str{"The quick brown fox jumps over the lazy dog"};
+  for (auto c : std::string_view{"Tqbfjotlzd\xFFx"})
+    EXPECT_EQ(ztl::strchr(str, c), std::strchr(str, c));
+  EXPECT_EQ(ztl::strchr(str, '\0'), str + ztl::strlen(str));
+  static_assert(*ztl::strchr("abc", 'b') == 'b');
+  static_assert(!ztl::strchr("abc", 'd'));
+
+  alignas(16) std::array<char, 64uz> buf{};
+  for (auto i{0uz}; i < 16uz; ++i)
+    for (auto pos{0uz}; pos < 40uz; ++pos) {
+      std::ranges::fill(buf, '\0');
+      std::fill_n(&buf[i], 40uz, 'a');
+      buf[i + pos] = '\xE4';
+      EXPECT_EQ(ztl::strchr(&buf[i], '\xE4'), &buf[i + pos]);
+      EXPECT_EQ(ztl::strchr(&buf[i], 'b'), nullptr);
+    }
 }
 
 TEST(string, strncpy) {
@@ -55,4 +106,192 @@ TEST(string, strncpy) {
 TEST(string, strstr) {
   EXPECT_TRUE(ztl::strstr("Hello World", "World"));
   EXPECT_FALSE(ztl::strstr("Hello World", "Dreamland"));
+
+  constexpr auto haystack{"abababcab aab abc ababc"};
+  for (auto needle : {"", "a", "c", "abc", "ababc", "b a", "abd", "cab aab"})
+    EXPECT_EQ(ztl::strstr(haystack, needle), std::strstr(haystack, needle));
+  static_assert(ztl::strstr("Hello World", "World") != nullptr);
+}
+
+TEST(string, strstr_long_needle) {
+  std::string haystack(1000uz, 'x');
+  std::string needle(300uz, 'x');
+  needle.back() = 'y';
+  EXPECT_EQ(ztl::strstr(data(haystack), data(needle)), nullptr);
+  haystack.replace(600uz, size(needle), needle);
+  EXPECT_EQ(ztl::strstr(data(haystack), data(needle)), &haystack[600uz]);
+}
+
+TEST(string, strstr_stops_at_terminator) {
+  // Characters past the terminator must never be matched
+  constexpr char haystack[]{"abc needle\0 needle longer needle"};
+  for (auto needle : {"e", "needle", "needle longer", "needle longer needle"})
+    EXPECT_EQ(ztl::strstr(haystack, needle), std::strstr(haystack, needle));
+  EXPECT_EQ(ztl::strstr("abcdefg", "abcdefgh"), nullptr);
+  constexpr auto str{"xxabcdefgh"};
+  EXPECT_EQ(ztl::strstr(str, "abcdefgh"), str + 2);
+  static_assert(ztl::strstr("0123456789", "3456789") != nullptr);
+  static_assert(ztl::strstr("0123456789", "23456789") != nullptr);
+  static_assert(ztl::strstr("0123456789", "123456780") == nullptr);
+}
+
+TEST(string, strstr_all_alignments) {
+  // Terminator and match at every position relative to word boundaries
+  alignas(16) std::array<char, 64uz> buf{};
+  constexpr auto needle{"0123456789"};
+  for (auto first{0uz}; first < 16uz; ++first)
+    for (auto len{0uz}; first + len < size(buf); ++len) {
+      std::fill(begin(buf), end(buf), 'x');
+      buf[first + len] = '\0';
+      for (auto pos{first}; pos + 10uz <= first + len; pos += 7uz)
+        std::copy_n(needle, 10uz, &buf[pos]);
+      EXPECT_EQ(ztl::strstr(&buf[first], needle),
+                std::strstr(&buf[first], needle));
+    }
+}
+
+TEST(string, searcher) {
+  using ztl::operator""_fs;
+  constexpr ztl::searcher<"ERROR"_fs> error;
+  constexpr std::string_view log{
+    "INFO boot\nWARN low voltage\nERROR overcurrent"};
+  EXPECT_EQ(error(data(log), data(log) + size(log)), data(log) + 27);
+  EXPECT_EQ(error(data(log), data(log) + 30), nullptr);
+  EXPECT_EQ(ztl::searcher<"WARN">{}("INFO boot"), nullptr);
+  static_assert(ztl::searcher<"lo">{}("Hello") != nullptr);
+  EXPECT_TRUE(
+    (std::same_as<decltype(error.table)::value_type, uint8_t>));
+}
+
+namespace {
+
+template<typename T>
+void expect_round_trip(T value, int base) {
+  std::array<char, 80uz> ztl_buf{};
+  std::array<char, 80uz> std_buf{};
+  auto const [ztl_ptr, ztl_ec]{
+    ztl::to_chars(begin(ztl_buf), end(ztl_buf), value, base)};
+  auto const [std_ptr, std_ec]{
+    std::to_chars(begin(std_buf), end(std_buf), value, base)};
+  ASSERT_EQ(ztl_ec, std::errc{});
+  ASSERT_EQ((std::string_view{begin(ztl_buf), ztl_ptr}),
+            (std::string_view{begin(std_buf), std_ptr}));
+  T parsed{};
+  auto const [ptr, ec]{ztl::from_chars(begin(ztl_buf), ztl_ptr, parsed, base)};
+  EXPECT_EQ(ec, std::errc{});
+  EXPECT_EQ(ptr, ztl_ptr);
+  EXPECT_EQ(parsed, value);
+}
+
+template<typename T>
+void expect_round_trips() {
+  using L = std::numeric_limits<T>;
+  for (auto base : {2, 8, 10, 16, 36})
+    for (auto value : {T{}, T{1}, T{9}, T{10}, T{99}, T{100}, L::max(),
+                       static_cast<T>(L::max() - 1), L::min(),
+                       static_cast<T>(L::min() + 1), static_cast<T>(-1),
+                       static_cast<T>(L::max() / 3)})
+      expect_round_trip(value, base);
+}
+
+} // namespace
+
+TEST(string, to_chars_from_chars_round_trip) {
+  expect_round_trips<int8_t>();
+  expect_round_trips<uint8_t>();
+  expect_round_trips<int16_t>();
+  expect_round_trips<uint16_t>();
+  expect_round_trips<int32_t>();
+  expect_round_trips<uint32_t>();
+  expect_round_trips<int64_t>();
+  expect_round_trips<uint64_t>();
+  for (auto i{0u}; i < 100'000u; i += 7u) expect_round_trip(i * 4099u, 10);
+}
+
+TEST(string, from_chars_errors) {
+  constexpr std::string_view overflow{"256"};
+  uint8_t u8{42u};
+  auto const [ptr, ec]{ztl::from_chars(begin(overflow), end(overflow), u8)};
+  EXPECT_EQ(ec, std::errc::result_out_of_range);
+  EXPECT_EQ(ptr, end(overflow));
+  EXPECT_EQ(u8, 42u);
+
+  constexpr std::string_view min{"-128"};
+  int8_t i8{};
+  EXPECT_EQ(ztl::from_chars(begin(min), end(min), i8).ec, std::errc{});
+  EXPECT_EQ(i8, -128);
+  constexpr std::string_view below_min{"-129"};
+  EXPECT_EQ(ztl::from_chars(begin(below_min), end(below_min), i8).ec,
+            std::errc::result_out_of_range);
+
+  constexpr std::string_view invalid{"-x1"};
+  int32_t i32{};
+  auto const invalid_result{
+    ztl::from_chars(begin(invalid), end(invalid), i32)};
+  EXPECT_EQ(invalid_result.ec, std::errc::invalid_argument);
+  EXPECT_EQ(invalid_result.ptr, begin(invalid));
+  uint32_t u32{};
+  EXPECT_EQ(ztl::from_chars(begin(min), end(min), u32).ec,
+            std::errc::invalid_argument);
+
+  constexpr std::string_view trailing{"FfZ"};
+  auto const trailing_result{
+    ztl::from_chars(begin(trailing), end(trailing), u32, 16)};
+  EXPECT_EQ(trailing_result.ec, std::errc{});
+  EXPECT_EQ(trailing_result.ptr, begin(trailing) + 2);
+  EXPECT_EQ(u32, 0xFFu);
+}
+
+TEST(string, to_chars_too_small) {
+  std::array<char, 3uz> buf{};
+  EXPECT_EQ(ztl::to_chars(begin(buf), end(buf), 1000).ec,
+            std::errc::value_too_large);
+  EXPECT_EQ(ztl::to_chars(begin(buf), end(buf), -100).ec,
+            std::errc::value_too_large);
+  auto const [ptr, ec]{ztl::to_chars(begin(buf), end(buf), -99)};
+  EXPECT_EQ(ec, std::errc{});
+  EXPECT_EQ((std::string_view{begin(buf), ptr}), "-99");
+}
+
+TEST(string, to_chars_constexpr) {
+  static_assert([] {
+    std::array<char, 8uz> buf{};
+    auto const ptr{ztl::to_chars(begin(buf), end(buf), 0xBEEFu, 16).ptr};
+    uint32_t value{};
+    ztl::from_chars(begin(buf), ptr, value, 16);
+    return value == 0xBEEFu && buf[0uz] == 'b';
+  }());
+}
+
+TEST(string, to_binary_chars) {
+  std::array<char, 80uz> buf{};
+  auto [ptr, ec]{ztl::to_binary_chars(uint8_t{0xA5u}, buf)};
+  EXPECT_EQ(ec, std::errc{});
+  EXPECT_EQ((std::string_view{data(buf), ptr}), "0b1010'0101");
+
+  ptr = ztl::to_binary_chars(int16_t{-2}, buf, '\0').ptr;
+  EXPECT_EQ((std::string_view{data(buf), ptr}), "0b1111111111111110");
+
+  // Same output as the printf macros
+  std::array<char, 80uz> printf_buf{};
+  auto const value{0x8000'1234u};
+  std::snprintf(data(printf_buf),
+                size(printf_buf),
+                UINT32_TO_BINARY_FORMAT,
+                UINT32_TO_BINARY(value));
+  ptr = ztl::to_binary_chars(value, buf).ptr;
+  EXPECT_EQ((std::string_view{data(buf), ptr}),
+            std::string_view{data(printf_buf)});
+
+  std::array<char, 10uz> small{};
+  EXPECT_EQ(ztl::to_binary_chars(uint8_t{}, small).ec,
+            std::errc::value_too_large);
+}
+
+TEST(string, to_binary_chars_fixed_string) {
+  constexpr auto str{ztl::to_binary_chars(uint16_t{0x0F01u})};
+  EXPECT_EQ(std::string_view{str.c_str()}, "0b0000'1111'0000'0001");
+  constexpr auto no_separator{ztl::to_binary_chars<'\0'>(int8_t{5})};
+  EXPECT_EQ(std::string_view{no_separator.c_str()}, "0b00000101");
+  static_assert(ztl::to_binary_chars(1ull)[80uz] == '1');
 }